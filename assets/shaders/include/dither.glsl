@@ -0,0 +1,9 @@
+// ---- Ordered (Bayer 8x8) Dither ----
+// ditherScale = ditherIntensity / (colorLevels - 1), precomputed on the CPU.
+uniform sampler2D ditherTexture;
+uniform float ditherScale;
+
+vec3 dither(vec3 color) {
+    float threshold = texelFetch(ditherTexture, ivec2(gl_FragCoord.xy) & 7, 0).r - 0.5;
+    return color + threshold * ditherScale;
+}
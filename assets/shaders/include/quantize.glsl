@@ -0,0 +1,7 @@
+// ---- Color Quantization ----
+// quantize(color) is baked into a 3D LUT on the CPU (see PostProcess).
+uniform sampler3D paletteLut;
+
+vec3 quantize(vec3 color) {
+    return texture(paletteLut, clamp(color, 0.0, 1.0)).rgb;
+}
@@ -0,0 +1,17 @@
+// ---- Upsample Sharpening ----
+// Cross-shaped unsharp mask, limited by local contrast so edges that are
+// already hard do not ring.
+uniform vec2 texelSize;
+uniform float sharpenStrength;
+
+vec3 sharpen(sampler2D source, vec2 uv, vec2 uvMax, vec3 center) {
+    vec3 north = texture(source, min(uv + vec2(0.0, texelSize.y), uvMax)).rgb;
+    vec3 south = texture(source, max(uv - vec2(0.0, texelSize.y), vec2(0.0))).rgb;
+    vec3 east = texture(source, min(uv + vec2(texelSize.x, 0.0), uvMax)).rgb;
+    vec3 west = texture(source, max(uv - vec2(texelSize.x, 0.0), vec2(0.0))).rgb;
+
+    vec3 low = min(center, min(min(north, south), min(east, west)));
+    vec3 high = max(center, max(max(north, south), max(east, west)));
+    vec3 detail = center * 4.0 - north - south - east - west;
+    return clamp(center + detail * 0.25 * sharpenStrength, low, high);
+}
@@ -0,0 +1,23 @@
+// ---- GPU Skinning ----
+// Joint palette written by SkinningBuffer; must match MAX_JOINTS in Animation.hpp.
+#define MAX_JOINTS 128
+
+layout(std140) uniform Skinning {
+    mat4 joints[MAX_JOINTS];
+};
+
+uniform bool skinned;
+
+// Vertices nobody weighted (rigid meshes, or skinned ones with gaps) stay put.
+mat4 skin_matrix(ivec4 boneIds, vec4 weights) {
+    if (!skinned) return mat4(1.0);
+
+    mat4 skin = mat4(0.0);
+    float total = 0.0;
+    for (int i = 0; i < 4; i++) {
+        if (boneIds[i] < 0 || boneIds[i] >= MAX_JOINTS) continue;
+        skin += joints[boneIds[i]] * weights[i];
+        total += weights[i];
+    }
+    return total > 0.0 ? skin / total : mat4(1.0);
+}
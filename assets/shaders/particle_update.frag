@@ -0,0 +1,7 @@
+#version 330 core
+// Never runs: the update pass draws with GL_RASTERIZER_DISCARD.
+out vec4 FragColor;
+
+void main() {
+    FragColor = vec4(0.0);
+}
@@ -0,0 +1,78 @@
+#version 330 core
+// ---- Particle Simulation (Transform Feedback, One Vertex Per Particle) ----
+// Slots [spawnBegin, spawnBegin + spawnCount) of the ring are respawned this
+// frame; every other slot just integrates. Dead particles have age >= life.
+layout(location = 0) in vec4 aPositionAge;
+layout(location = 1) in vec4 aVelocityLife;
+
+out vec4 outPositionAge;
+out vec4 outVelocityLife;
+
+uniform float deltaTime;
+uniform uint capacity;
+uniform uint spawnBegin;
+uniform uint spawnCount;
+uniform uint seed;
+
+// ---- Emitter ----
+// Spawns are spread along the emitter's path since the last frame, so fast
+// emitters leave a continuous trail.
+uniform vec3 spawnFrom;
+uniform vec3 spawnTo;
+uniform vec3 direction;
+uniform float spread;
+uniform float spawnRadius;
+uniform vec2 speedRange;
+uniform vec2 lifetimeRange;
+uniform vec3 gravity;
+uniform float drag;
+
+uint hash(uint x) {
+    x ^= x >> 16u;
+    x *= 0x7feb352du;
+    x ^= x >> 15u;
+    x *= 0x846ca68bu;
+    x ^= x >> 16u;
+    return x;
+}
+
+float random(inout uint state) {
+    state = hash(state);
+    return float(state >> 8u) / 16777216.0;
+}
+
+vec3 random_unit(inout uint state) {
+    float z = random(state) * 2.0 - 1.0;
+    float angle = random(state) * 6.2831853;
+    float radius = sqrt(max(0.0, 1.0 - z * z));
+    return vec3(radius * cos(angle), radius * sin(angle), z);
+}
+
+void main() {
+    uint id = uint(gl_VertexID);
+    uint slot = (id + capacity - spawnBegin) % capacity;
+
+    if (slot < spawnCount) {
+        uint state = hash(id ^ hash(seed));
+        float along = (float(slot) + random(state)) / float(spawnCount);
+        vec3 position = mix(spawnFrom, spawnTo, along) + random_unit(state) * (spawnRadius * random(state));
+        vec3 heading = direction + random_unit(state) * spread;
+        heading = dot(heading, heading) > 1e-8 ? normalize(heading) : random_unit(state);
+        vec3 velocity = heading * mix(speedRange.x, speedRange.y, random(state));
+
+        // ---- Born Partway Through The Frame: Earlier Along The Path, Older ----
+        float age = deltaTime * (1.0 - along);
+        outPositionAge = vec4(position + velocity * age, age);
+        outVelocityLife = vec4(velocity, mix(lifetimeRange.x, lifetimeRange.y, random(state)));
+        return;
+    }
+
+    vec3 position = aPositionAge.xyz;
+    vec3 velocity = aVelocityLife.xyz;
+    if (aPositionAge.w < aVelocityLife.w) {
+        velocity = (velocity + gravity * deltaTime) / (1.0 + drag * deltaTime);
+        position += velocity * deltaTime;
+    }
+    outPositionAge = vec4(position, aPositionAge.w + deltaTime);
+    outVelocityLife = vec4(velocity, aVelocityLife.w);
+}
@@ -0,0 +1,11 @@
+#version 330 core
+in vec2 vCorner;
+in vec4 vColor;
+out vec4 FragColor;
+
+// Premultiplied for GL_ONE, GL_ONE: additive, so draw order never matters.
+void main() {
+    float falloff = 1.0 - dot(vCorner, vCorner);
+    if (falloff <= 0.0) discard;
+    FragColor = vec4(vColor.rgb * vColor.a * falloff * falloff, 0.0);
+}
@@ -0,0 +1,30 @@
+#version 330 core
+// ---- Instanced Billboards: One Instance Per Particle, Corners From gl_VertexID ----
+layout(location = 0) in vec4 aPositionAge;
+layout(location = 1) in vec4 aVelocityLife;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec2 size;
+uniform vec4 colorStart;
+uniform vec4 colorEnd;
+
+out vec2 vCorner;
+out vec4 vColor;
+
+void main() {
+    vCorner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0 - 1.0;
+
+    // ---- Dead: Collapse Outside The Clip Volume ----
+    if (aPositionAge.w >= aVelocityLife.w) {
+        vColor = vec4(0.0);
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        return;
+    }
+
+    float t = aPositionAge.w / aVelocityLife.w;
+    vec4 eye = view * vec4(aPositionAge.xyz, 1.0);
+    eye.xy += vCorner * mix(size.x, size.y, t);
+    vColor = mix(colorStart, colorEnd, t);
+    gl_Position = projection * eye;
+}
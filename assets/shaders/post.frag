@@ -0,0 +1,41 @@
+#version 330 core
+in vec2 TexCoords;
+out vec4 FragColor;
+
+uniform sampler2D screenTexture;
+
+// ---- Rendered Region Of screenTexture (Dynamic Resolution) ----
+uniform vec2 uvScale;
+uniform vec2 uvMax;
+
+// ---- Effects Are Fused At Build Time (see PostProcess) ----
+#ifdef APPLY_SHARPEN
+#include "include/sharpen.glsl"
+#endif
+
+#ifdef APPLY_QUANTIZE
+#include "include/quantize.glsl"
+#endif
+
+#ifdef APPLY_DITHER
+#include "include/dither.glsl"
+#endif
+
+void main() {
+    vec2 uv = min(TexCoords * uvScale, uvMax);
+    vec3 color = texture(screenTexture, uv).rgb;
+
+#ifdef APPLY_SHARPEN
+    color = sharpen(screenTexture, uv, uvMax, color);
+#endif
+
+#ifdef APPLY_DITHER
+    color = dither(color);
+#endif
+
+#ifdef APPLY_QUANTIZE
+    color = quantize(color);
+#endif
+
+    FragColor = vec4(clamp(color, 0.0, 1.0), 1.0);
+}
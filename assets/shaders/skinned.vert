@@ -0,0 +1,32 @@
+#version 330 core
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec2 aTexCoords;
+layout(location = 5) in ivec4 aBoneIds;
+layout(location = 6) in vec4 aWeights;
+layout(location = 7) in vec4 aColor;
+layout(location = 8) in float aUseDiffuseTexture;
+
+#include "include/skinning.glsl"
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+// ---- Same Outputs As basic.vert, So basic.frag Lights Skinned Meshes Too ----
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoords;
+out vec4 Color;
+out float UseDiffuseTexture;
+
+void main() {
+    mat4 skin = skin_matrix(aBoneIds, aWeights);
+    FragPos = vec3(model * skin * vec4(aPos, 1.0));
+    // Clips may carry (non-uniform) scale keys, so the skinned matrix needs the inverse-transpose too.
+    Normal = transpose(inverse(mat3(model * skin))) * aNormal;
+    TexCoords = aTexCoords;
+    Color = aColor;
+    UseDiffuseTexture = aUseDiffuseTexture;
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
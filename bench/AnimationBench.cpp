@@ -0,0 +1,160 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+ * Animation microbenchmark: clip compression ratio and error, and characters
+ * sampled, blended and skinned per frame with and without the pose cache.
+ */
+
+#include "Animation.hpp"
+#include "AnimationCompression.hpp"
+#include "PoseCache.hpp"
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  constexpr std::uint32_t JOINTS = 64;
+  constexpr float CLIP_SECONDS = 2.0f;
+  constexpr int KEYS_PER_SECOND = 30;
+  constexpr std::size_t CHARACTERS = 2000;
+  constexpr int FRAMES = 60;
+  constexpr double FRAME_BUDGET_MS = 1000.0 / 60.0;
+  // Crowd scenario: characters split into this many in-step groups.
+  constexpr std::size_t CROWD_GROUPS = 8;
+
+  double elapsed_ms(const Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  }
+
+  // ---- Humanoid-Sized Tree: Each Joint Hangs Off One Of The Previous Four ----
+  STARBORN::Skeleton make_skeleton() {
+    STARBORN::Skeleton skeleton;
+    for (std::uint32_t joint = 0; joint < JOINTS; joint++) {
+      skeleton.names.push_back("joint_" + std::to_string(joint));
+      skeleton.parents.push_back(joint == 0 ? STARBORN::Skeleton::NO_JOINT : joint - 1 - joint % std::min(joint, 4u));
+      skeleton.bind_pose.push_back({glm::vec3(0.0f, 0.1f, 0.0f)});
+      skeleton.bone_joints.push_back(joint);
+      skeleton.inverse_binds.emplace_back(1.0f);
+    }
+    return skeleton;
+  }
+
+  STARBORN::AnimationClip make_clip(const float phase) {
+    STARBORN::AnimationClip clip;
+    clip.duration = CLIP_SECONDS;
+    const int keys = static_cast<int>(CLIP_SECONDS * KEYS_PER_SECOND) + 1;
+    for (std::uint32_t joint = 0; joint < JOINTS; joint++) {
+      STARBORN::AnimationClip::Track track;
+      track.joint = joint;
+      for (int key = 0; key < keys; key++) {
+        const float time = static_cast<float>(key) / KEYS_PER_SECOND;
+        const float angle = std::sin(time * 3.0f + phase + static_cast<float>(joint)) * 0.5f;
+        track.positions.times.push_back(time);
+        track.positions.values.emplace_back(0.0f, 0.1f, 0.0f);
+        track.rotations.times.push_back(time);
+        track.rotations.values.emplace_back(std::cos(angle), std::sin(angle), 0.0f, 0.0f);
+      }
+      clip.tracks.push_back(std::move(track));
+    }
+    return clip;
+  }
+
+  // ---- Worst Joint Position Error Of The Compressed Clip, In Model Space ----
+  float max_error(const STARBORN::Skeleton &skeleton, const STARBORN::AnimationClip &raw,
+                  const STARBORN::CompressedClip &compressed) {
+    STARBORN::Pose raw_pose, compressed_pose;
+    std::vector<glm::mat4> raw_joints, compressed_joints;
+    float worst = 0.0f;
+    for (float time = 0.0f; time <= raw.duration; time += 1.0f / 240.0f) {
+      STARBORN::reset_pose(skeleton, raw_pose);
+      STARBORN::reset_pose(skeleton, compressed_pose);
+      STARBORN::sample(raw, time, raw_pose);
+      STARBORN::sample(compressed, time, compressed_pose);
+      STARBORN::compute_skinning(skeleton, raw_pose, raw_joints, {});
+      STARBORN::compute_skinning(skeleton, compressed_pose, compressed_joints, {});
+      for (std::size_t joint = 0; joint < raw_joints.size(); joint++) {
+        worst = std::max(worst, length(glm::vec3(raw_joints[joint][3]) - glm::vec3(compressed_joints[joint][3])));
+      }
+    }
+    return worst;
+  }
+
+  // ---- Every Character Cross-Fading, So Each Samples Two Clips And Blends ----
+  double blend_frame_ms(STARBORN::JobSystem &jobs, std::vector<STARBORN::Animator> &animators,
+                        const STARBORN::CompressedClip &walk, const STARBORN::CompressedClip &run) {
+    for (std::size_t i = 0; i < animators.size(); i++) {
+      animators[i].set_pose_cache(nullptr);
+      animators[i].play(walk);
+      animators[i].set_time(static_cast<float>(i) * 0.01f);
+      animators[i].play(run, 1000.0f);
+    }
+
+    double best = 1e30;
+    for (int frame = 0; frame < FRAMES; frame++) {
+      const auto start = Clock::now();
+      jobs.parallel_for(animators.size(), 16, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) animators[i].update(1.0f / 60.0f);
+      });
+      best = std::min(best, elapsed_ms(start));
+    }
+    return best;
+  }
+
+  // ---- Crowd Playing One Clip In A Few Synced Groups, Optionally Through The Cache ----
+  double crowd_frame_ms(STARBORN::JobSystem &jobs, std::vector<STARBORN::Animator> &animators,
+                        const STARBORN::CompressedClip &walk, STARBORN::PoseCache *cache) {
+    for (std::size_t i = 0; i < animators.size(); i++) {
+      animators[i].set_pose_cache(cache);
+      animators[i].play(walk);
+      animators[i].set_time(static_cast<float>(i % CROWD_GROUPS) * 0.25f);
+    }
+
+    double best = 1e30;
+    for (int frame = 0; frame < FRAMES; frame++) {
+      const auto start = Clock::now();
+      if (cache) cache->clear();
+      jobs.parallel_for(animators.size(), 16, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) animators[i].update(1.0f / 60.0f);
+      });
+      best = std::min(best, elapsed_ms(start));
+    }
+    return best;
+  }
+}
+
+int main() {
+  auto &jobs = STARBORN::JobSystem::get_instance();
+  const STARBORN::Skeleton skeleton = make_skeleton();
+  const STARBORN::AnimationClip raw_walk = make_clip(0.0f);
+  const STARBORN::AnimationClip raw_run = make_clip(1.5f);
+  const STARBORN::CompressedClip walk = STARBORN::compress(raw_walk);
+  const STARBORN::CompressedClip run = STARBORN::compress(raw_run);
+  std::vector<STARBORN::Animator> animators(CHARACTERS, STARBORN::Animator(skeleton));
+  STARBORN::PoseCache cache;
+
+  std::printf("clip: %zu bytes raw, %zu compressed (%.1fx), max joint error %.5f\n",
+              STARBORN::get_byte_size(raw_walk), walk.get_byte_size(),
+              static_cast<double>(STARBORN::get_byte_size(raw_walk)) / static_cast<double>(walk.get_byte_size()),
+              max_error(skeleton, raw_walk, walk));
+
+  const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+  std::printf("%u joints, %zu characters; crowd = %zu synced groups\n", JOINTS, CHARACTERS, CROWD_GROUPS);
+  std::printf("%-8s %-14s %-20s %-14s %-14s\n", "threads", "blend ms", "blend chars/16.6ms", "crowd ms", "cached ms");
+
+  for (unsigned int threads = 1; threads <= cores; threads++) {
+    jobs.init(threads - 1);
+    const double blend = blend_frame_ms(jobs, animators, walk, run);
+    const double crowd = crowd_frame_ms(jobs, animators, walk, nullptr);
+    const double cached = crowd_frame_ms(jobs, animators, walk, &cache);
+    std::printf("%-8u %-14.3f %-20.0f %-14.3f %-14.3f\n", threads, blend,
+                FRAME_BUDGET_MS / blend * CHARACTERS, crowd, cached);
+  }
+
+  jobs.shutdown();
+  return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+ * Job system microbenchmark: dispatch overhead and parallel_for scaling.
+ */
+
+#include "JobSystem.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  constexpr int DISPATCH_JOBS = 100'000;
+  constexpr std::size_t SCALING_ELEMENTS = 1 << 22;
+  constexpr int REPEATS = 5;
+
+  double elapsed_ms(const Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  }
+
+  // ---- Empty Jobs: Cost Of Queueing, Stealing And Counting Alone ----
+  double dispatch_ns_per_job(STARBORN::JobSystem &jobs) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+      STARBORN::JobSystem::Counter counter;
+      STARBORN::JobSystem::Job job;
+      job.function = [](void *, std::size_t, std::size_t) {};
+      job.counter = &counter;
+
+      const auto start = Clock::now();
+      for (int i = 0; i < DISPATCH_JOBS; i++) jobs.submit(job);
+      jobs.wait(counter);
+      best = std::min(best, elapsed_ms(start) * 1e6 / DISPATCH_JOBS);
+    }
+    return best;
+  }
+
+  // ---- ALU-Bound Loop: How Close To Linear The Pool Scales ----
+  double scaling_ms(STARBORN::JobSystem &jobs, std::vector<float> &data) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+      const auto start = Clock::now();
+      jobs.parallel_for(data.size(), 16 * 1024, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+          float value = data[i];
+          for (int k = 0; k < 16; k++) value = std::sqrt(value * value + 1.0f) * 0.5f;
+          data[i] = value;
+        }
+      });
+      best = std::min(best, elapsed_ms(start));
+    }
+    return best;
+  }
+}
+
+int main() {
+  auto &jobs = STARBORN::JobSystem::get_instance();
+  std::vector<float> data(SCALING_ELEMENTS, 1.0f);
+
+  const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+  std::printf("%-8s %-16s %-14s %-8s\n", "threads", "dispatch ns/job", "parallel ms", "speedup");
+
+  double baseline = 0.0;
+  for (unsigned int threads = 1; threads <= cores; threads++) {
+    // ---- The Calling Thread Helps, So N Threads Means N - 1 Workers ----
+    jobs.init(threads - 1);
+    const double dispatch = dispatch_ns_per_job(jobs);
+    const double parallel = scaling_ms(jobs, data);
+    if (threads == 1) baseline = parallel;
+    std::printf("%-8u %-16.1f %-14.2f %-8.2f\n", threads, dispatch, parallel, baseline / parallel);
+  }
+
+  jobs.shutdown();
+  return 0;
+}
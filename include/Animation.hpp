@@ -0,0 +1,128 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Components.hpp"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace STARBORN {
+
+struct CompressedClip;
+class PoseCache;
+
+// Joints in the shader's palette (see assets/shaders/include/skinning.glsl).
+constexpr std::size_t MAX_JOINTS = 128;
+
+// ---- Skeleton ----
+// Every node of the source file is a joint, stored parent-before-child like
+// TransformHierarchy, so a pose resolves to model space in one forward pass.
+// Bones are the joints meshes are actually skinned to.
+struct Skeleton {
+  static constexpr std::uint32_t NO_JOINT = 0xffffffffu;
+
+  std::vector<std::string> names;
+  std::vector<std::uint32_t> parents;
+  std::vector<Transform> bind_pose;
+
+  std::vector<std::uint32_t> bone_joints;
+  // Mesh space to bone space at bind time (aiBone::mOffsetMatrix).
+  std::vector<glm::mat4> inverse_binds;
+
+  [[nodiscard]] std::uint32_t find_joint(std::string_view name) const;
+  [[nodiscard]] std::size_t get_joint_count() const { return parents.size(); }
+  [[nodiscard]] std::size_t get_bone_count() const { return bone_joints.size(); }
+};
+
+// ---- Clip ----
+struct AnimationClip {
+  template <typename T>
+  struct Channel {
+    std::vector<float> times;
+    std::vector<T> values;
+  };
+
+  struct Track {
+    std::uint32_t joint = Skeleton::NO_JOINT;
+    Channel<glm::vec3> positions;
+    Channel<glm::quat> rotations;
+    Channel<glm::vec3> scales;
+  };
+
+  std::string name;
+  // Seconds.
+  float duration = 0.0f;
+  std::vector<Track> tracks;
+};
+
+// Local transform of every joint.
+using Pose = std::vector<Transform>;
+
+// ---- Pose Operations ----
+void reset_pose(const Skeleton &skeleton, Pose &pose);
+// Overwrites the joints the clip animates; the rest keep their value.
+void sample(const AnimationClip &clip, float time, Pose &pose);
+// Translation and scale lerp, rotation nlerp along the shortest arc.
+void blend(const Pose &from, const Pose &to, float weight, Pose &out);
+// Resolves `pose` to model space in `joints`, then writes one skinning
+// matrix per bone to `palette`.
+void compute_skinning(const Skeleton &skeleton, const Pose &pose,
+                      std::vector<glm::mat4> &joints, std::span<glm::mat4> palette);
+
+// ---- Animator ----
+// Per-instance playback of compressed clips: the current clip, an optional
+// cross-fade into the next one, and the resulting palette. update()
+// allocates nothing after the first call, so many animators can be stepped
+// across the job system. With a PoseCache, animators in step share samples.
+class Animator {
+private:
+  // ---- Variables ----
+  const Skeleton *skeleton_ = nullptr;
+  const CompressedClip *clip_ = nullptr;
+  const CompressedClip *next_clip_ = nullptr;
+  PoseCache *pose_cache_ = nullptr;
+  float time_ = 0.0f;
+  float next_time_ = 0.0f;
+  float fade_ = 0.0f;
+  float fade_duration_ = 0.0f;
+  float speed_ = 1.0f;
+  bool looping_ = true;
+
+  Pose pose_;
+  Pose next_pose_;
+  std::vector<glm::mat4> joints_;
+  std::vector<glm::mat4> palette_;
+
+  // ---- Private Methods ----
+  void sample_pose(const CompressedClip &clip, float time, Pose &pose) const;
+public:
+  // ---- Constructor ----
+  Animator() = default;
+  explicit Animator(const Skeleton &skeleton);
+
+  // ---- Playback ----
+  // Cross-fades over `fade_seconds`, or cuts when it is zero.
+  void play(const CompressedClip &clip, float fade_seconds = 0.0f);
+  void update(float delta_time);
+
+  // ---- Getters ----
+  [[nodiscard]] std::span<const glm::mat4> get_palette() const { return palette_; }
+  [[nodiscard]] const Pose &get_pose() const { return pose_; }
+  [[nodiscard]] float get_time() const { return time_; }
+
+  // ---- Setters ----
+  void set_speed(const float speed) { speed_ = speed; }
+  void set_looping(const bool looping) { looping_ = looping; }
+  void set_time(const float time) { time_ = time; }
+  // Shared by every animator stepped in the same tick; nullptr to sample alone.
+  void set_pose_cache(PoseCache *pose_cache) { pose_cache_ = pose_cache; }
+};
+
+} // STARBORN
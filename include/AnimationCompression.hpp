@@ -0,0 +1,63 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Animation.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// ---- Compressed Clip ----
+// What runtime playback reads. Keys that linear interpolation can rebuild
+// within tolerance are dropped, times are 16-bit fractions of the duration,
+// vectors are 16 bits per axis inside each channel's own min/extent box,
+// and rotations are smallest-three quaternions in 48 bits. Every key of
+// every channel sits in two flat arrays.
+struct CompressedClip {
+  struct Channel {
+    std::uint32_t first_key = 0;
+    // Zero leaves the joint at its bind value.
+    std::uint32_t key_count = 0;
+    // Vectors only: value = minimum + quantized * extent.
+    glm::vec3 minimum{0.0f};
+    glm::vec3 extent{0.0f};
+  };
+
+  struct Track {
+    std::uint32_t joint = Skeleton::NO_JOINT;
+    Channel positions;
+    Channel rotations;
+    Channel scales;
+  };
+
+  std::string name;
+  float duration = 0.0f;
+  std::vector<Track> tracks;
+  std::vector<std::uint16_t> times;
+  std::vector<std::array<std::uint16_t, 3>> values;
+
+  [[nodiscard]] std::size_t get_byte_size() const;
+};
+
+struct CompressionSettings {
+  // Largest error a dropped key may introduce: units for position and
+  // scale, radians for rotation.
+  float position_tolerance = 0.0005f;
+  float rotation_tolerance = 0.001f;
+  float scale_tolerance = 0.0005f;
+};
+
+// ---- Compression ----
+CompressedClip compress(const AnimationClip &clip, const CompressionSettings &settings = {});
+[[nodiscard]] std::size_t get_byte_size(const AnimationClip &clip);
+
+// ---- Sampling ----
+// Same contract as sample(const AnimationClip &, ...).
+void sample(const CompressedClip &clip, float time, Pose &pose);
+
+} // STARBORN
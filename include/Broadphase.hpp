@@ -0,0 +1,66 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace STARBORN {
+
+// Sweep-and-prune over axis-aligned boxes. Proxies are kept in an order
+// sorted by their minimum x; since bodies move little per tick, re-sorting
+// that order with insertion sort is close to linear. The sweep then only
+// compares boxes whose x intervals overlap, split across the job system.
+class Broadphase {
+public:
+  // a < b.
+  struct Pair {
+    std::uint32_t a;
+    std::uint32_t b;
+  };
+private:
+  // One array per bound, so the sweep streams through contiguous floats.
+  struct Bounds {
+    std::vector<float> min_x, min_y, min_z;
+    std::vector<float> max_x, max_y, max_z;
+
+    void resize(std::size_t size);
+  };
+
+  // ---- Variables ----
+  Bounds bounds_;
+  std::vector<std::uint32_t> free_;
+  // Every slot ever created, dead ones included (they sort to the end).
+  std::vector<std::uint32_t> order_;
+  std::size_t sorted_count_ = 0;
+  // bounds_ gathered into sweep order.
+  Bounds sorted_;
+  std::vector<std::vector<Pair>> batch_pairs_;
+  std::vector<Pair> pairs_;
+  std::size_t alive_ = 0;
+
+  // ---- Private Methods ----
+  void sort();
+  void sweep();
+public:
+  static constexpr std::size_t SWEEP_GRAIN = 1024;
+
+  // ---- Proxies ----
+  std::uint32_t create(const glm::vec3 &minimum, const glm::vec3 &maximum);
+  void destroy(std::uint32_t proxy);
+  void set_bounds(std::uint32_t proxy, const glm::vec3 &minimum, const glm::vec3 &maximum);
+  void clear();
+
+  // ---- Update ----
+  // Re-sorts and rebuilds the overlapping pairs.
+  void update();
+
+  // ---- Getters ----
+  [[nodiscard]] const std::vector<Pair> &get_pairs() const { return pairs_; }
+  [[nodiscard]] std::size_t get_proxy_count() const { return alive_; }
+};
+
+} // STARBORN
@@ -6,35 +6,96 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <array>
 
 namespace STARBORN {
+  // Matrices and frustum planes are cached and only rebuilt when a setter
+  // touched something they depend on, so any number of passes can query
+  // them per frame for free.
   class Camera {
+  public:
+    // ---- Frustum Planes (xyz = Inward Normal, w = Distance) ----
+    enum FrustumPlane { PLANE_LEFT, PLANE_RIGHT, PLANE_BOTTOM, PLANE_TOP, PLANE_NEAR, PLANE_FAR, PLANE_COUNT };
+    using Frustum = std::array<glm::vec4, PLANE_COUNT>;
+
+    enum class Projection {
+      // OpenGL default: depth -1..1, near maps to -1, finite far plane.
+      STANDARD,
+      // Near maps to depth 1 and infinity to 0. Needs a 0..1 clip range
+      // (glClipControl), GL_GREATER and a float depth buffer; far_plane_ is ignored.
+      REVERSE_Z_INFINITE,
+    };
   private:
     // ---- Variables ----
     glm::vec3 position_;
-    glm::vec3 target_;
     glm::vec3 direction_{};
-    glm::vec3 up_{};
+    glm::vec3 up_{0.0f, 1.0f, 0.0f};
     glm::vec3 right_{};
     glm::vec3 camera_up_{};
-    glm::mat4 projection_{};
+    // Vertical field of view in degrees.
+    float fov_;
+    float aspect_ratio_;
+    float near_plane_;
+    float far_plane_;
+    Projection projection_mode_ = Projection::STANDARD;
+
+    // ---- Cache ----
+    mutable glm::mat4 view_{1.0f};
+    mutable glm::mat4 projection_{1.0f};
+    mutable glm::mat4 view_projection_{1.0f};
+    mutable glm::mat4 inverse_view_{1.0f};
+    mutable glm::mat4 inverse_projection_{1.0f};
+    mutable glm::mat4 inverse_view_projection_{1.0f};
+    mutable Frustum frustum_{};
+    mutable bool view_dirty_ = true;
+    mutable bool projection_dirty_ = true;
+    mutable bool derived_dirty_ = true;
+
+    // ---- Private Methods ----
+    void update_basis();
+    void update_view() const;
+    void update_projection() const;
+    void update_derived() const;
   public:
     // ---- Constructor ----
     Camera(const glm::vec3& position, const glm::vec3& target, float fov, float aspect_ratio, float near_plane, float far_plane);
 
+    // ---- Matrices ----
+    [[nodiscard]] const glm::mat4& get_view_matrix() const;
+    [[nodiscard]] const glm::mat4& get_projection_matrix() const;
+    [[nodiscard]] const glm::mat4& get_view_projection_matrix() const;
+    [[nodiscard]] const glm::mat4& get_inverse_view_matrix() const;
+    [[nodiscard]] const glm::mat4& get_inverse_projection_matrix() const;
+    [[nodiscard]] const glm::mat4& get_inverse_view_projection_matrix() const;
+
+    // ---- Frustum ----
+    [[nodiscard]] const Frustum& get_frustum_planes() const;
+    [[nodiscard]] bool is_sphere_visible(const glm::vec3& center, float radius) const;
+
     // ---- Getters ----
-    [[nodiscard]] glm::mat4 get_view_matrix() const;
-    [[nodiscard]] glm::mat4 get_projection_matrix() const;
     [[nodiscard]] glm::vec3 get_position() const { return position_; };
     [[nodiscard]] glm::vec3 get_direction() const { return direction_; };
     [[nodiscard]] glm::vec3 get_up() const { return up_; };
     [[nodiscard]] glm::vec3 get_right() const { return right_; };
     [[nodiscard]] glm::vec3 get_camera_up() const { return camera_up_; };
-    [[nodiscard]] glm::vec3 get_target() const { return target_; };
+    [[nodiscard]] glm::vec3 get_target() const { return position_ + direction_; };
+    [[nodiscard]] float get_fov() const { return fov_; };
+    [[nodiscard]] float get_aspect_ratio() const { return aspect_ratio_; };
+    [[nodiscard]] float get_near_plane() const { return near_plane_; };
+    [[nodiscard]] float get_far_plane() const { return far_plane_; };
+    [[nodiscard]] Projection get_projection_mode() const { return projection_mode_; };
 
     // ---- Setters ----
-    void set_position(const glm::vec3& position) { position_ = position; };
-    void set_direction(const glm::vec3& direction) { direction_ = direction; };
-    void set_target(const glm::vec3& target) { target_ = target; };
+    void set_position(const glm::vec3& position);
+    // `direction` is where the camera looks; it does not need to be normalized.
+    void set_direction(const glm::vec3& direction);
+    void set_target(const glm::vec3& target);
+    // Position and direction together, rebuilding the basis once.
+    void set_view(const glm::vec3& position, const glm::vec3& direction);
+    void set_fov(float fov);
+    void set_aspect_ratio(float aspect_ratio);
+    void set_near_plane(float near_plane);
+    void set_far_plane(float far_plane);
+    void set_projection_mode(Projection projection_mode);
   };
 } // STARBORN
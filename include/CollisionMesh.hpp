@@ -0,0 +1,109 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace STARBORN {
+
+// ---- Queries ----
+struct Ray {
+  glm::vec3 origin{0.0f};
+  // Normalized.
+  glm::vec3 direction{0.0f, 0.0f, -1.0f};
+  float max_distance = 1e30f;
+};
+
+struct RayHit {
+  float distance = 0.0f;
+  glm::vec3 normal{0.0f};
+  std::uint32_t triangle = 0;
+};
+
+// Sphere of `radius` swept along the segment a-b.
+struct Capsule {
+  glm::vec3 a{0.0f};
+  glm::vec3 b{0.0f};
+  float radius = 0.0f;
+};
+
+struct SweepHit {
+  // Fraction of the motion travelled before touching.
+  float fraction = 1.0f;
+  // Points from the surface towards the capsule.
+  glm::vec3 normal{0.0f};
+  glm::vec3 point{0.0f};
+  // How far the capsule already overlaps at the start (fraction is then 0).
+  float depth = 0.0f;
+};
+
+// Static triangle soup behind a SAH bounding volume hierarchy. Leaves hold
+// up to four triangles packed structure-of-arrays, so a leaf is one 4-wide
+// SSE ray/triangle test; node boxes are slab-tested with SSE as well.
+// Built once per model and cached on disk keyed by the geometry.
+class CollisionMesh {
+public:
+  static constexpr std::uint32_t LEAF_SIZE = 4;
+  static constexpr std::uint32_t NO_TRIANGLE = 0xffffffffu;
+
+  // 32 bytes. Leaves (count > 0) point at a pack; inner nodes at their
+  // left child, with the right child right after it.
+  struct Node {
+    glm::vec3 minimum;
+    std::uint32_t index;
+    glm::vec3 maximum;
+    std::uint32_t count;
+  };
+
+  // Unused lanes are degenerate and carry NO_TRIANGLE.
+  struct alignas(16) TrianglePack {
+    float v0[3][LEAF_SIZE];
+    float e1[3][LEAF_SIZE];
+    float e2[3][LEAF_SIZE];
+    std::uint32_t ids[LEAF_SIZE];
+  };
+private:
+  struct BuildTriangle;
+
+  // ---- Variables ----
+  std::vector<Node> nodes_;
+  std::vector<TrianglePack> packs_;
+  std::size_t triangle_count_ = 0;
+
+  // ---- Private Methods ----
+  void build_node(std::uint32_t node, std::vector<BuildTriangle> &triangles, std::size_t begin, std::size_t end);
+  void make_leaf(Node &node, const std::vector<BuildTriangle> &triangles, std::size_t begin, std::size_t end);
+  void query(const glm::vec3 &minimum, const glm::vec3 &maximum, std::vector<std::uint32_t> &packs) const;
+public:
+  // ---- Build ----
+  void build(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices);
+  // Loads the tree for this geometry from `directory`, or builds and stores it.
+  void build_cached(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices,
+                    const std::filesystem::path &directory = "cache/collision");
+  void clear();
+
+  // ---- Cache ----
+  [[nodiscard]] static std::uint64_t make_key(std::span<const glm::vec3> positions,
+                                              std::span<const std::uint32_t> indices);
+  bool load(const std::filesystem::path &path, std::uint64_t key);
+  void save(const std::filesystem::path &path, std::uint64_t key) const;
+
+  // ---- Queries ----
+  bool raycast(const Ray &ray, RayHit &hit) const;
+  // Earliest contact of `capsule` moving by `motion`, found by conservative
+  // advancement against every triangle near the swept volume.
+  bool sweep_capsule(const Capsule &capsule, const glm::vec3 &motion, SweepHit &hit) const;
+
+  // ---- Getters ----
+  [[nodiscard]] bool is_empty() const { return nodes_.empty(); }
+  [[nodiscard]] std::size_t get_node_count() const { return nodes_.size(); }
+  [[nodiscard]] std::size_t get_triangle_count() const { return triangle_count_; }
+};
+
+} // STARBORN
@@ -0,0 +1,44 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "CollisionMesh.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace STARBORN {
+
+// Placed collision meshes. Queries go into each instance's model space and
+// come back out, so one cooked tree serves every placement of a model.
+// Transforms are rigid with uniform scale.
+class CollisionScene {
+private:
+  struct Instance {
+    const CollisionMesh *mesh;
+    glm::mat4 transform;
+    glm::mat4 inverse;
+    float scale;
+  };
+
+  // ---- Variables ----
+  std::vector<Instance> instances_;
+public:
+  // ---- Instances ----
+  std::uint32_t add(const CollisionMesh &mesh, const glm::mat4 &transform);
+  void set_transform(std::uint32_t instance, const glm::mat4 &transform);
+  void clear() { instances_.clear(); }
+
+  // ---- Queries ----
+  // Closest hit across every instance, in world space.
+  bool raycast(const Ray &ray, RayHit &hit) const;
+  // Earliest contact across every instance, in world space.
+  bool sweep_capsule(const Capsule &capsule, const glm::vec3 &motion, SweepHit &hit) const;
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t size() const { return instances_.size(); }
+};
+
+} // STARBORN
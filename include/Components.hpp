@@ -0,0 +1,56 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+
+namespace STARBORN {
+
+class Model;
+
+// ---- Core ECS Components ----
+// Plain data so they can live in archetype chunks (see World.hpp).
+
+struct Transform {
+  glm::vec3 position{0.0f};
+  glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+  glm::vec3 scale{1.0f};
+};
+
+// Index of the entity's node in a scene-owned TransformHierarchy, whose
+// locals are Transforms.
+struct TransformNode {
+  std::uint32_t node = 0;
+};
+
+// Written from the entity's transform once per tick and read by extraction.
+struct WorldMatrix {
+  glm::mat4 value{1.0f};
+};
+
+// Body in the scene's PhysicsWorld that drives the entity's transform.
+struct RigidBody {
+  std::uint32_t body = 0;
+};
+
+struct MeshRenderer {
+  static constexpr std::uint32_t NO_ANIMATOR = 0xffffffffu;
+
+  // Owned by the scene, like FramePacket::DrawItem::model.
+  Model *model = nullptr;
+  // Index into the scene's Animators for skinned models.
+  std::uint32_t animator = NO_ANIMATOR;
+};
+
+// ---- Resources ----
+// Never attached to entities. Systems name these in their Schedule access
+// masks to declare reads and writes of scene-owned data outside the World.
+
+// The scene's TransformHierarchy (locals and cached world matrices).
+struct TransformHierarchyResource {};
+
+} // STARBORN
@@ -0,0 +1,71 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <array>
+
+namespace STARBORN {
+
+// Picks the internal render resolution from measured GPU frame time. The
+// scene target keeps its full size; only the viewport shrinks, so changing
+// scale never reallocates, and the post pass upsamples the used region.
+class DynamicResolution {
+public:
+  struct Config {
+    float target_frame_ms = 16.6f;
+    float min_scale = 0.5f;
+    float max_scale = 1.0f;
+    // Scale changes snap to this step so small timing noise does not move it.
+    float step = 0.05f;
+    bool enabled = true;
+  };
+private:
+  // ---- Timer Queries ----
+  // A small ring so results are read a few frames late instead of stalling.
+  static constexpr int QUERY_COUNT = 4;
+  std::array<unsigned int, QUERY_COUNT> queries_{};
+  std::array<bool, QUERY_COUNT> query_pending_{};
+  int query_index_ = 0;
+  bool timing_ = false;
+
+  // ---- Controller State ----
+  Config config_;
+  float scale_ = 1.0f;
+  float gpu_time_ms_ = 0.0f;
+  int cooldown_frames_ = 0;
+
+  // ---- Private Methods ----
+  void collect_results();
+  void adjust(float frame_ms);
+public:
+  // ---- Constructor & Destructor ----
+  DynamicResolution() = default;
+  ~DynamicResolution() = default;
+
+  DynamicResolution(const DynamicResolution&) = delete;
+  DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+  // ---- Lifecycle ----
+  void init();
+  void cleanup();
+
+  // ---- Frame ----
+  // Wrap all GPU work of a frame.
+  void begin_frame();
+  void end_frame();
+
+  // ---- Getters ----
+  [[nodiscard]] float get_scale() const { return config_.enabled ? scale_ : 1.0f; }
+  [[nodiscard]] float get_gpu_time_ms() const { return gpu_time_ms_; }
+  // Size of the region to render into for a target of `width` x `height`.
+  [[nodiscard]] glm::ivec2 get_render_size(int width, int height) const;
+
+  // ---- Setters ----
+  void set_config(const Config &config);
+};
+
+} // STARBORN
@@ -0,0 +1,46 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace STARBORN {
+
+// Reports files that changed since the last poll(). Uses inotify on Linux
+// (watching directories so editors that save via rename are caught) and
+// falls back to throttled modification-time checks elsewhere.
+class FileWatcher {
+private:
+  // ---- Internal State ----
+  std::unordered_set<std::string> files_;
+#ifdef __linux__
+  int fd_ = -1;
+  std::unordered_map<int, std::string> directories_;
+#else
+  std::unordered_map<std::string, std::filesystem::file_time_type> timestamps_;
+  double last_scan_ = 0.0;
+#endif
+public:
+  // ---- Constructor & Destructor ----
+  FileWatcher();
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  // ---- Watching ----
+  void watch(const std::string &path);
+  [[nodiscard]] bool is_watching(const std::string &path) const { return files_.contains(path); }
+
+  // ---- Polling ----
+  // Non-blocking. Returns each changed, watched file once, as passed to watch().
+  std::vector<std::string> poll();
+};
+
+} // STARBORN
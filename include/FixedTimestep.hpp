@@ -0,0 +1,33 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+namespace STARBORN {
+
+// Accumulates real time and hands it out as whole simulation ticks of a
+// fixed length, so results do not depend on frame rate. The remainder is
+// exposed as an interpolation factor for rendering between the last two ticks.
+class FixedTimestep {
+private:
+  double step_;
+  int max_steps_;
+  double accumulator_ = 0.0;
+  double last_time_ = -1.0;
+public:
+  // ---- Constructor ----
+  explicit FixedTimestep(double tick_rate = 60.0, int max_steps = 5);
+
+  // ---- Advance ----
+  // Number of ticks to run for the time elapsed until `now` (seconds). At
+  // most `max_steps`; time beyond that is dropped so a hitch cannot snowball.
+  int advance(double now);
+
+  // ---- Getters ----
+  [[nodiscard]] float get_step() const { return static_cast<float>(step_); }
+  // Fraction of a tick elapsed since the last one, in [0, 1).
+  [[nodiscard]] float get_alpha() const { return static_cast<float>(accumulator_ / step_); }
+};
+
+} // STARBORN
@@ -6,17 +6,49 @@
 
 #include <glad/glad.h>
 #include <stdexcept>
+#include <vector>
 
 namespace STARBORN {
+  // ---- Attachment Layout ----
+  struct FrameBufferDesc {
+    // One entry per color attachment, e.g. GL_RGB8, GL_RGBA16F or GL_R11F_G11F_B10F for HDR.
+    std::vector<GLenum> color_formats{GL_RGB8};
+    // 0 for no depth attachment.
+    GLenum depth_format = GL_DEPTH24_STENCIL8;
+    // Keep depth in a texture that can be sampled after the pass.
+    bool depth_texture = false;
+    // > 1 renders into multisampled renderbuffers that resolve() blits into the textures.
+    int samples = 1;
+
+    bool operator==(const FrameBufferDesc &) const = default;
+  };
+
   class FrameBuffer {
   private:
-    unsigned int FBO{}, texture_color_buffer{}, rbo{};
+    unsigned int FBO{}, rbo{};
+    std::vector<unsigned int> color_textures_;
+    unsigned int depth_texture_{};
+
+    // ---- Multisampling ----
+    unsigned int msaa_FBO{};
+    std::vector<unsigned int> msaa_color_buffers_;
+    unsigned int msaa_depth_buffer_{};
+
+    FrameBufferDesc desc_;
     int width_, height_;
+
+    // ---- Private Methods ----
+    void create_attachments();
+    void destroy_attachments();
+    [[nodiscard]] unsigned int render_FBO() const { return msaa_FBO ? msaa_FBO : FBO; }
   public:
     // ---- Constructor & Destructor ----
-    FrameBuffer(int width, int height);
+    FrameBuffer(int width, int height, const FrameBufferDesc &desc = {});
     ~FrameBuffer();
 
+    FrameBuffer(const FrameBuffer&) = delete;
+    FrameBuffer& operator=(const FrameBuffer&) = delete;
+
     // ---- Bind & Unbind ----
     void bind() const;
     void unbind();
@@ -24,9 +56,20 @@ namespace STARBORN {
     // ---- Resize ----
     void resize(int width, int height);
 
+    // ---- End Of Pass ----
+    // Resolves multisampled attachments into the sampleable textures.
+    void resolve() const;
+    // Resolves, then, unless a later pass renders into this target again
+    // (`keep_contents`), tells the driver that the multisampled storage and
+    // a renderbuffer depth attachment need not be written back.
+    void end_pass(bool keep_contents) const;
+
     // ---- Getters & Setters ----
-    [[nodiscard]] unsigned int get_texture_id() const { return texture_color_buffer; }
+    [[nodiscard]] unsigned int get_texture_id(const std::size_t index = 0) const { return color_textures_[index]; }
+    [[nodiscard]] unsigned int get_depth_texture_id() const { return depth_texture_; }
     [[nodiscard]] int get_width() const { return width_; }
     [[nodiscard]] int get_height() const { return height_; }
+    [[nodiscard]] bool is_multisampled() const { return msaa_FBO != 0; }
+    [[nodiscard]] const FrameBufferDesc& get_desc() const { return desc_; }
   };
-}
\ No newline at end of file
+}
@@ -0,0 +1,74 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// Controls how frames are presented and how far the CPU may run ahead of
+// the GPU. Call wait_for_gpu() on the thread owning the context before
+// input for a frame is sampled, and end_frame() right after swapping buffers.
+class FramePacer {
+public:
+  enum class Mode {
+    UNCAPPED,
+    VSYNC,
+    // Syncs when on time, tears instead of waiting a whole refresh when late.
+    ADAPTIVE_VSYNC,
+    // Caps to `frame_rate` with sleep followed by a short spin.
+    FIXED_RATE,
+  };
+
+  struct Config {
+    Mode mode = Mode::VSYNC;
+    double frame_rate = 60.0;
+    // Frames the CPU may queue ahead of the GPU; lower means less input latency.
+    int max_frames_in_flight = 2;
+  };
+private:
+  using Clock = std::chrono::steady_clock;
+
+  // ---- Variables ----
+  GLFWwindow *window_ = nullptr;
+  Config config_;
+  std::vector<GLsync> fences_;
+  int fence_index_ = 0;
+  Clock::time_point next_deadline_{};
+
+  // ---- Private Methods ----
+  void apply_swap_interval() const;
+  void wait_for_deadline();
+public:
+  // ---- Constructor & Destructor ----
+  FramePacer() = default;
+  ~FramePacer() = default;
+
+  FramePacer(const FramePacer&) = delete;
+  FramePacer& operator=(const FramePacer&) = delete;
+
+  // ---- Lifecycle ----
+  void init(GLFWwindow *window, const Config &config);
+  void cleanup();
+
+  // ---- Frame ----
+  // Blocks until the GPU has finished the frame from `max_frames_in_flight` frames ago.
+  void wait_for_gpu();
+  void end_frame();
+
+  // ---- Setters & Getters ----
+  void set_config(const Config &config);
+  [[nodiscard]] const Config& get_config() const { return config_; }
+
+  // ---- Parsing ----
+  // "uncapped", "vsync", "adaptive" or "fixed"; anything else is VSYNC.
+  static Mode parse_mode(const std::string &name);
+};
+
+} // STARBORN
@@ -0,0 +1,79 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace STARBORN {
+
+class Model;
+class Scene;
+
+// Everything the render thread needs to draw one frame, captured by the
+// simulation thread. Plain data only: nothing in here may be touched by
+// the simulation again once the packet is submitted.
+struct FramePacket {
+  struct CameraData {
+    glm::mat4 view{1.0f};
+    glm::mat4 projection{1.0f};
+    glm::vec3 position{0.0f};
+  };
+
+  struct DrawItem {
+    // GPU resources stay owned by the scene; the render thread only draws them.
+    Model *model = nullptr;
+    glm::mat4 transform{1.0f};
+    // Range in joint_palettes; empty for rigid draws.
+    std::uint32_t joint_offset = 0;
+    std::uint32_t joint_count = 0;
+  };
+
+  struct Light {
+    glm::vec3 position{0.0f};
+    glm::vec3 color{1.0f};
+  };
+
+  // Where an emitter is this frame and how many particles it spawns.
+  struct ParticleEmission {
+    std::uint32_t emitter = 0;
+    glm::vec3 position{0.0f};
+    glm::vec3 direction{0.0f, 1.0f, 0.0f};
+    std::uint32_t spawn_count = 0;
+    // Spawns appear at `position` only, instead of trailing from where the
+    // emitter was last frame. Set for point bursts that jump around.
+    bool teleport = false;
+  };
+
+  // ---- Frame ----
+  std::uint64_t frame_index = 0;
+  Scene *scene = nullptr;
+  int width = 0;
+  int height = 0;
+  // glfwGetTime() of the newest input reflected in this frame.
+  double input_time = 0.0;
+  // Seconds since the previous packet, for effects stepped once per frame.
+  float delta_time = 0.0f;
+
+  // ---- View ----
+  CameraData camera;
+  std::vector<DrawItem> draw_items;
+  std::vector<Light> lights;
+  // Skinning matrices of every animated draw item, back to back.
+  std::vector<glm::mat4> joint_palettes;
+  std::vector<ParticleEmission> particle_emissions;
+
+  // Keeps vector capacity so packets stop allocating after the first few frames.
+  void clear() {
+    scene = nullptr;
+    draw_items.clear();
+    lights.clear();
+    joint_palettes.clear();
+    particle_emissions.clear();
+  }
+};
+
+} // STARBORN
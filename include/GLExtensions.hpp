@@ -0,0 +1,57 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+
+// ---- ARB_get_program_binary (core in 4.1) ----
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#endif
+
+// ---- KHR_parallel_shader_compile ----
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// ---- ARB_clip_control (core in 4.5) ----
+#ifndef GL_ZERO_TO_ONE
+#define GL_NEGATIVE_ONE_TO_ONE 0x935E
+#define GL_ZERO_TO_ONE 0x935F
+#endif
+
+namespace STARBORN {
+  namespace GLExtensions {
+    // ---- Function Pointer Types ----
+    typedef void (APIENTRYP PFN_GET_PROGRAM_BINARY)(GLuint program, GLsizei buf_size, GLsizei *length, GLenum *binary_format, void *binary);
+    typedef void (APIENTRYP PFN_PROGRAM_BINARY)(GLuint program, GLenum binary_format, const void *binary, GLsizei length);
+    typedef void (APIENTRYP PFN_PROGRAM_PARAMETERI)(GLuint program, GLenum pname, GLint value);
+    typedef void (APIENTRYP PFN_MAX_SHADER_COMPILER_THREADS)(GLuint count);
+    typedef void (APIENTRYP PFN_INVALIDATE_FRAMEBUFFER)(GLenum target, GLsizei num_attachments, const GLenum *attachments);
+    typedef void (APIENTRYP PFN_CLIP_CONTROL)(GLenum origin, GLenum depth);
+
+    // ---- Entry Points (nullptr when unavailable) ----
+    extern PFN_GET_PROGRAM_BINARY get_program_binary;
+    extern PFN_PROGRAM_BINARY program_binary;
+    extern PFN_PROGRAM_PARAMETERI program_parameteri;
+    extern PFN_MAX_SHADER_COMPILER_THREADS max_shader_compiler_threads;
+    extern PFN_INVALIDATE_FRAMEBUFFER invalidate_framebuffer;
+    extern PFN_CLIP_CONTROL clip_control;
+
+    // ---- Loading ----
+    // Must be called once after GLAD has loaded the core 3.3 entry points.
+    void load();
+    [[nodiscard]] bool has_extension(const char *name);
+
+    // ---- Feature Queries ----
+    [[nodiscard]] bool has_program_binary();
+    [[nodiscard]] bool has_parallel_shader_compile();
+    [[nodiscard]] bool has_clip_control();
+  }
+}
@@ -4,16 +4,49 @@
 
 #pragma once
 
+#include "SPSCQueue.hpp"
 #include <GLFW/glfw3.h>
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <glm/glm.hpp>
+#include <span>
 #include <vector>
 
 namespace STARBORN {
 
+// One raw input event, in the order GLFW delivered it during the frame.
+struct InputEvent {
+  enum class Type : std::uint8_t { KEY, MOUSE_BUTTON, CURSOR, SCROLL };
+
+  Type type;
+  // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT for keys and buttons.
+  std::uint8_t action;
+  // Key or button code.
+  std::int16_t code;
+  // Cursor position or scroll offset.
+  float x;
+  float y;
+  // Seconds on the glfwGetTime() clock.
+  double time;
+};
+
+// GLFW callbacks run on the thread pumping events and only push into a
+// lock-free queue; the simulation thread drains it in update() and again,
+// as late as possible, in poll() right before a frame is captured.
 class Input {
+public:
+  // ---- Limits ----
+  static constexpr int KEY_COUNT = GLFW_KEY_LAST + 1;
+  static constexpr int MOUSE_BUTTON_COUNT = GLFW_MOUSE_BUTTON_LAST + 1;
+  static constexpr std::size_t MAX_EVENTS = 256;
+  static constexpr std::size_t QUEUE_CAPACITY = 1024;
 private:
+  static constexpr int KEY_WORDS = (KEY_COUNT + 63) / 64;
+  using KeyBits = std::array<std::uint64_t, KEY_WORDS>;
+
   // ---- Constructor & Destructor ----
   Input() = default;
   ~Input() = default;
@@ -26,20 +59,49 @@ private:
 
   // ---- Internal State ----
   GLFWwindow* window_ = nullptr;
+  std::atomic<bool> live_{true};
+
+  // ---- Event Thread -> Simulation Thread ----
+  SPSCQueue<InputEvent, QUEUE_CAPACITY> queue_;
+  std::atomic<std::size_t> queue_overflows_{0};
 
-  // ---- Key States ----
-  std::unordered_map<int, bool> current_keys_;
-  std::unordered_map<int, bool> previous_keys_;
+  // ---- Key States (One Bit Per GLFW Key Code) ----
+  KeyBits current_keys_{};
+  KeyBits previous_keys_{};
 
   // ---- Mouse States ----
-  std::unordered_map<int, bool> current_mouse_buttons_;
-  std::unordered_map<int, bool> previous_mouse_buttons_;
-  glm::vec2 current_cursor_position_;
-  glm::vec2 previous_cursor_position_;
+  std::uint32_t current_mouse_buttons_ = 0;
+  std::uint32_t previous_mouse_buttons_ = 0;
+  glm::vec2 current_cursor_position_{0.0f};
+  glm::vec2 previous_cursor_position_{0.0f};
+
+  // ---- State The Simulation Ticked On ----
+  // Snapshot taken before late events are polled, so next frame's edges
+  // still see a press that only arrived after this frame's ticks.
+  KeyBits latched_keys_{};
+  std::uint32_t latched_mouse_buttons_ = 0;
+  glm::vec2 latched_cursor_position_{0.0f};
+  bool latched_ = false;
+  double last_event_time_ = 0.0;
 
   // ---- Scroll States ----
   float scroll_delta_ = 0.0f;
 
+  // ---- This Frame's Events ----
+  std::array<InputEvent, MAX_EVENTS> events_{};
+  std::size_t event_count_ = 0;
+  std::size_t late_begin_ = 0;
+  std::size_t dropped_events_ = 0;
+
+  // ---- Private Methods ----
+  void latch();
+  void drain();
+  static void enqueue(const InputEvent &event);
+  void apply_event(const InputEvent &event);
+  bool push_event(const InputEvent &event);
+  static bool is_valid_key(const int key) { return static_cast<unsigned int>(key) < KEY_COUNT; }
+  static bool is_valid_button(const int button) { return static_cast<unsigned int>(button) < MOUSE_BUTTON_COUNT; }
+
   // ---- Callbacks ----
   std::vector<std::function<void(int, int)>> key_callbacks_;
   std::vector<std::function<void(double, double)>> mouse_callbacks_;
@@ -58,28 +120,48 @@ public:
   void init(GLFWwindow* window);
 
   // ---- Update ----
+  // Starts a frame: last frame's state becomes "previous" and queued events are applied.
   void update();
+  // Applies events that arrived since update() without starting a new
+  // frame. Call right before capturing the frame to render.
+  void poll();
+
+  // ---- Injection ----
+  // Feeds an event through the same path as a GLFW callback (state, queue,
+  // listeners). Used by replay, which also turns live input off.
+  void inject(const InputEvent &event) { apply_event(event); };
+  void set_live(const bool live) { live_ = live; };
 
   // ---- Query Key State ----
-  bool is_key_pressed(const int key) {
-    return current_keys_[key] && !previous_keys_[key];
+  // Edges are the XOR of this frame's and last frame's words, masked by
+  // the side that is set. Out-of-range codes (GLFW_KEY_UNKNOWN) read as up.
+  [[nodiscard]] bool is_key_pressed(const int key) const {
+    if (!is_valid_key(key)) return false;
+    const std::uint64_t word = current_keys_[key >> 6];
+    return ((word ^ previous_keys_[key >> 6]) & word) >> (key & 63) & 1u;
   };
-  bool is_key_released(const int key) {
-    return !current_keys_[key] && previous_keys_[key];
+  [[nodiscard]] bool is_key_released(const int key) const {
+    if (!is_valid_key(key)) return false;
+    const std::uint64_t word = previous_keys_[key >> 6];
+    return ((word ^ current_keys_[key >> 6]) & word) >> (key & 63) & 1u;
   };
-  bool is_key_down(const int key) {
-    return current_keys_[key];
+  [[nodiscard]] bool is_key_down(const int key) const {
+    if (!is_valid_key(key)) return false;
+    return current_keys_[key >> 6] >> (key & 63) & 1u;
   };
 
   // --- Query Mouse State ----
-  bool is_mouse_button_pressed(int button) {
-    return current_mouse_buttons_[button] && !previous_mouse_buttons_[button];
+  [[nodiscard]] bool is_mouse_button_pressed(const int button) const {
+    if (!is_valid_button(button)) return false;
+    return ((current_mouse_buttons_ ^ previous_mouse_buttons_) & current_mouse_buttons_) >> button & 1u;
   };
-  bool is_mouse_button_released(int button) {
-    return !current_mouse_buttons_[button] && previous_mouse_buttons_[button];
+  [[nodiscard]] bool is_mouse_button_released(const int button) const {
+    if (!is_valid_button(button)) return false;
+    return ((current_mouse_buttons_ ^ previous_mouse_buttons_) & previous_mouse_buttons_) >> button & 1u;
   };
-  bool is_mouse_button_down(int button) {
-    return current_mouse_buttons_[button];
+  [[nodiscard]] bool is_mouse_button_down(const int button) const {
+    if (!is_valid_button(button)) return false;
+    return current_mouse_buttons_ >> button & 1u;
   };
 
   // --- Query Cursor Position ----
@@ -95,6 +177,18 @@ public:
     return scroll_delta_;
   };
 
+  // --- Query Events ----
+  // Press/release order within the frame, which the state bits lose when a
+  // key goes down and up between two updates. Consecutive cursor moves and
+  // scrolls are merged, so the queue rarely fills; an event that does not
+  // fit is dropped whole, without touching the state bits.
+  [[nodiscard]] std::span<const InputEvent> get_events() const {
+    return {events_.data(), event_count_};
+  };
+  [[nodiscard]] std::size_t get_dropped_event_count() const { return dropped_events_ + queue_overflows_.load(); };
+  // glfwGetTime() of the newest event applied, for input-to-present latency.
+  [[nodiscard]] double get_last_event_time() const { return last_event_time_; };
+
   // --- Register Callbacks ----
   void register_key_callback(const std::function<void(int, int)>& callback) {
     key_callbacks_.push_back(callback);
@@ -0,0 +1,81 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Input.hpp"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// Writes each frame's input events, tick count and interpolation factor
+// to a compact binary file, so InputReplay can reproduce the session
+// exactly, independent of the frame rate it is replayed at.
+class InputRecorder {
+private:
+  std::ofstream file_;
+public:
+  // ---- Lifecycle ----
+  bool open(const std::string &path, double tick_rate);
+  void close();
+
+  // ---- Recording ----
+  void record_frame(double time, int ticks, float alpha, std::span<const InputEvent> events);
+
+  // ---- Getters ----
+  [[nodiscard]] bool is_open() const { return file_.is_open(); }
+};
+
+// Feeds a recording back into Input one frame at a time, replacing live
+// input and wall-clock ticks, and measures the frame time of the run
+// for A/B comparisons between builds.
+class InputReplay {
+public:
+  struct Step {
+    int ticks;
+    float alpha;
+  };
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Frame {
+    double time;
+    int ticks;
+    float alpha;
+    std::uint32_t first_event;
+    std::uint32_t event_count;
+  };
+
+  // ---- Recording ----
+  double tick_rate_ = 60.0;
+  std::vector<Frame> frames_;
+  std::vector<InputEvent> events_;
+  std::size_t next_frame_ = 0;
+
+  // ---- Timing ----
+  std::vector<double> frame_ms_;
+  Clock::time_point last_frame_{};
+public:
+  // ---- Loading ----
+  bool load(const std::string &path);
+
+  // ---- Playback ----
+  // Injects the next frame's events and returns how to step the
+  // simulation, or nothing once the recording is exhausted.
+  std::optional<Step> next_frame(Input &input);
+  // Prints frame-time statistics for the run so far.
+  void report() const;
+
+  // ---- Getters ----
+  [[nodiscard]] bool is_loaded() const { return !frames_.empty(); }
+  [[nodiscard]] double get_tick_rate() const { return tick_rate_; }
+};
+
+} // STARBORN
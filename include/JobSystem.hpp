@@ -0,0 +1,125 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace STARBORN {
+
+// Fixed pool of worker threads for CPU work (import, culling, animation,
+// scene update). Every worker owns a deque it pushes to and pops from at
+// the back; idle workers steal from the front of the others. Jobs report
+// to a Counter, and wait() runs queued jobs instead of sleeping, so a job
+// may wait on the jobs it depends on without starving the pool.
+// Jobs must not throw.
+class JobSystem {
+public:
+  using Function = void (*)(void *data, std::size_t begin, std::size_t end);
+
+  struct Counter {
+    std::atomic<int> pending{0};
+    [[nodiscard]] bool is_done() const { return pending.load(std::memory_order_acquire) == 0; }
+  };
+
+  // Kept trivially copyable so dispatch never allocates.
+  struct Job {
+    Function function = nullptr;
+    void *data = nullptr;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    Counter *counter = nullptr;
+  };
+private:
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  // ---- Variables ----
+  std::vector<std::thread> workers_;
+  // One per worker, plus a shared one at the back for threads outside the pool.
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::atomic<int> queued_{0};
+  std::atomic<int> sleeping_{0};
+  std::atomic<bool> stopping_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+
+  // ---- Private Methods ----
+  JobSystem() = default;
+  void worker_loop(std::size_t index);
+  bool try_run_one();
+  void push_range(Function function, void *data, std::size_t first, std::size_t count,
+                  std::size_t grain, Counter &counter);
+  void wake_workers(int jobs);
+  [[nodiscard]] std::size_t home_queue() const;
+  static void run(const Job &job);
+public:
+  // ---- Singleton Instance ----
+  static JobSystem &get_instance() {
+    static JobSystem instance;
+    return instance;
+  }
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+  ~JobSystem();
+
+  // ---- Lifecycle ----
+  // Defaults to one worker per core minus the calling thread, which helps
+  // while it waits. Zero workers runs everything inline.
+  void init(unsigned int worker_count = std::max(1u, std::thread::hardware_concurrency()) - 1);
+  // Finishes queued jobs, then joins the workers.
+  void shutdown();
+
+  // ---- Submission ----
+  void submit(const Job &job);
+  // Convenience for one-off tasks; allocates, so keep it off hot paths.
+  void submit(std::function<void()> task, Counter &counter);
+  // Runs other jobs until `counter` reaches zero.
+  void wait(const Counter &counter);
+
+  // Calls body(begin, end) over [0, count) in chunks of `grain` and waits.
+  // The calling thread runs the first chunk itself.
+  template <typename Body>
+  void parallel_for(std::size_t count, std::size_t grain, Body &&body);
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_worker_count() const { return workers_.size(); }
+};
+
+template <typename Body>
+void JobSystem::parallel_for(const std::size_t count, std::size_t grain, Body &&body) {
+  if (count == 0) return;
+  grain = std::max<std::size_t>(grain, 1);
+  if (workers_.empty() || count <= grain) {
+    body(std::size_t{0}, count);
+    return;
+  }
+
+  using BodyType = std::remove_reference_t<Body>;
+  const Function function = [](void *data, const std::size_t begin, const std::size_t end) {
+    (*static_cast<BodyType *>(data))(begin, end);
+  };
+  void *data = const_cast<void *>(static_cast<const void *>(&body));
+
+  // ---- Queue Everything Past The First Chunk, Then Work On It Here ----
+  Counter counter;
+  push_range(function, data, grain, count - grain, grain, counter);
+  body(std::size_t{0}, grain);
+  wait(counter);
+}
+
+} // STARBORN
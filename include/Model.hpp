@@ -5,10 +5,17 @@
 #pragma once
 
 #include "Mesh.hpp"
+#include "JobSystem.hpp"
+#include "TransformHierarchy.hpp"
+#include "AnimationCompression.hpp"
+#include "CollisionMesh.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <stb_image.h>
 #include <assimp/Importer.hpp>
@@ -41,8 +48,18 @@ namespace STARBORN {
     return material;
   }
 
+  // Assimp matrices are row-major, glm's are column-major.
+  inline glm::mat4 to_glm(const aiMatrix4x4 &m) {
+    return {glm::vec4(m.a1, m.b1, m.c1, m.d1), glm::vec4(m.a2, m.b2, m.c2, m.d2),
+            glm::vec4(m.a3, m.b3, m.c3, m.d3), glm::vec4(m.a4, m.b4, m.c4, m.d4)};
+  }
+
   class Model {
   private:
+    // ---- Import State ----
+    std::unordered_map<std::string, std::uint32_t> bone_lookup_;
+    std::vector<std::string> bone_names_;
+
     // ---- Private Methods ----
     void load_model(const std::string& path) {
       Assimp::Importer importer;
@@ -53,17 +70,105 @@ namespace STARBORN {
 
       directory_ = path.substr(0, path.find_last_of('/'));
 
-      process_node(scene->mRootNode, scene);
+      process_node(scene->mRootNode, scene, TransformHierarchy::NO_PARENT);
+      nodes_.update();
+      load_skeleton();
+      load_clips(scene);
+      load_collision();
+    }
+
+    void load_collision() {
+      // ---- One Soup In Model Space; Skinned Meshes Collide In Their Bind Pose ----
+      std::vector<glm::vec3> positions;
+      std::vector<std::uint32_t> indices;
+      for (std::size_t i = 0; i < meshes_.size(); i++) {
+        const glm::mat4 &world = nodes_.get_world(mesh_nodes_[i]);
+        const auto base = static_cast<std::uint32_t>(positions.size());
+        for (const auto &vertex : meshes_[i].vertices_) {
+          positions.push_back(mesh_skinned_[i] ? vertex.position : glm::vec3(world * glm::vec4(vertex.position, 1.0f)));
+        }
+        for (const unsigned int index : meshes_[i].indices_) indices.push_back(base + index);
+      }
+      collision_.build_cached(positions, indices);
     }
 
-    void process_node(aiNode *node, const aiScene *scene) {
+    void load_skeleton() {
+      // ---- Joints Mirror The Node Tree, Bones Resolve To Them By Name ----
+      for (std::uint32_t node = 0; node < nodes_.size(); node++) {
+        skeleton_.parents.push_back(nodes_.get_parent(node));
+        skeleton_.bind_pose.push_back(nodes_.get_local(node));
+      }
+      for (const auto &name : bone_names_) {
+        const std::uint32_t joint = skeleton_.find_joint(name);
+        if (joint == Skeleton::NO_JOINT) throw std::runtime_error("Bone without a node: " + name);
+        skeleton_.bone_joints.push_back(joint);
+      }
+      if (skeleton_.get_bone_count() > MAX_JOINTS) {
+        std::cerr << "ERROR::MODEL::TOO_MANY_BONES " << skeleton_.get_bone_count() << " > " << MAX_JOINTS << std::endl;
+      }
+
+      bone_lookup_.clear();
+      bone_names_.clear();
+    }
+
+    void load_clips(const aiScene *scene) {
+      for (unsigned int i = 0; i < scene->mNumAnimations; i++) {
+        const aiAnimation *animation = scene->mAnimations[i];
+        const double ticks_per_second = animation->mTicksPerSecond > 0.0 ? animation->mTicksPerSecond : 25.0;
+
+        AnimationClip clip;
+        clip.name = animation->mName.C_Str();
+        clip.duration = static_cast<float>(animation->mDuration / ticks_per_second);
+
+        for (unsigned int c = 0; c < animation->mNumChannels; c++) {
+          const aiNodeAnim *channel = animation->mChannels[c];
+          AnimationClip::Track track;
+          track.joint = skeleton_.find_joint(channel->mNodeName.C_Str());
+          if (track.joint == Skeleton::NO_JOINT) continue;
+
+          // ---- Key Times To Seconds ----
+          for (unsigned int k = 0; k < channel->mNumPositionKeys; k++) {
+            const auto &key = channel->mPositionKeys[k];
+            track.positions.times.push_back(static_cast<float>(key.mTime / ticks_per_second));
+            track.positions.values.emplace_back(key.mValue.x, key.mValue.y, key.mValue.z);
+          }
+          for (unsigned int k = 0; k < channel->mNumRotationKeys; k++) {
+            const auto &key = channel->mRotationKeys[k];
+            track.rotations.times.push_back(static_cast<float>(key.mTime / ticks_per_second));
+            track.rotations.values.emplace_back(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z);
+          }
+          for (unsigned int k = 0; k < channel->mNumScalingKeys; k++) {
+            const auto &key = channel->mScalingKeys[k];
+            track.scales.times.push_back(static_cast<float>(key.mTime / ticks_per_second));
+            track.scales.values.emplace_back(key.mValue.x, key.mValue.y, key.mValue.z);
+          }
+          clip.tracks.push_back(std::move(track));
+        }
+
+        // ---- Raw Keys Only Live Long Enough To Be Compressed ----
+        clips_.push_back(compress(clip));
+      }
+    }
+
+    void process_node(aiNode *node, const aiScene *scene, const std::uint32_t parent) {
+      // ---- Keep The Node's Local Transform; Depth-First Order Is Parent-Before-Child ----
+      aiVector3D scaling, position;
+      aiQuaternion rotation;
+      node->mTransformation.Decompose(scaling, rotation, position);
+      const std::uint32_t index = nodes_.add(parent, {glm::vec3(position.x, position.y, position.z),
+                                                      glm::quat(rotation.w, rotation.x, rotation.y, rotation.z),
+                                                      glm::vec3(scaling.x, scaling.y, scaling.z)});
+      skeleton_.names.emplace_back(node->mName.C_Str());
+
       for (unsigned int i = 0; i < node->mNumMeshes; i++) {
         aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
         meshes_.push_back(process_mesh(mesh, scene));
+        mesh_nodes_.push_back(index);
+        mesh_skinned_.push_back(mesh->HasBones());
       }
 
       for (unsigned int i = 0; i < node->mNumChildren; i++) {
-        process_node(node->mChildren[i], scene);
+        process_node(node->mChildren[i], scene, index);
       }
     }
 
@@ -72,60 +177,94 @@ namespace STARBORN {
       std::vector<unsigned int> indices;
       std::vector<Texture> textures;
 
-      for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
-        Vertex vertex;
-        glm::vec3 vector;
-
-        // ---- Positions ----
-        vector.x = mesh->mVertices[i].x;
-        vector.y = mesh->mVertices[i].y;
-        vector.z = mesh->mVertices[i].z;
-        vertex.position = vector;
-
-        // ---- Normals ----
-        if (mesh->HasNormals()) {
-          vector.x = mesh->mNormals[i].x;
-          vector.y = mesh->mNormals[i].y;
-          vector.z = mesh->mNormals[i].z;
-          vertex.normal = vector;
-        }
+      // ---- Per-Mesh Material Flags, Shared By Every Vertex ----
+      const bool has_material = scene->mNumMaterials > mesh->mMaterialIndex;
+      bool has_diffuse_color = false;
+      aiColor4D diffuse;
+      float use_diffuse_texture = 0.0f;
+      if (has_material) {
+        const auto &mat = scene->mMaterials[mesh->mMaterialIndex];
+        has_diffuse_color = AI_SUCCESS == aiGetMaterialColor(mat, AI_MATKEY_COLOR_DIFFUSE, &diffuse);
+        if (mat->GetTextureCount(aiTextureType_DIFFUSE) > 0) use_diffuse_texture = 1.0f;
+      }
 
-        // ---- Texture Coordinates ----
-        if (mesh->mTextureCoords[0]) {
-          glm::vec2 vec;
-          vec.x = mesh->mTextureCoords[0][i].x;
-          vec.y = mesh->mTextureCoords[0][i].y;
-          vertex.tex_coords = vec;
-
-          // ---- Tangent ----
-          vector.x = mesh->mTangents[i].x;
-          vector.y = mesh->mTangents[i].y;
-          vector.z = mesh->mTangents[i].z;
-          vertex.tangent = vector;
-
-          // ---- Bitangent ----
-          vector.x = mesh->mBitangents[i].x;
-          vector.y = mesh->mBitangents[i].y;
-          vector.z = mesh->mBitangents[i].z;
-          vertex.bitangent = vector;
-        } else vertex.tex_coords = glm::vec2(0.0f, 0.0f);
-
-        if (scene->mNumMaterials > mesh->mMaterialIndex) {
-          const auto &mat = scene->mMaterials[mesh->mMaterialIndex];
-          aiColor4D diffuse;
-
-          if (AI_SUCCESS == aiGetMaterialColor(mat, AI_MATKEY_COLOR_DIFFUSE, &diffuse)) {
-            vertex.color = glm::vec4(diffuse.r, diffuse.g, diffuse.b, diffuse.a);
+      // ---- Vertices Are Independent, Convert Them Across The Job System ----
+      vertices.resize(mesh->mNumVertices);
+      JobSystem::get_instance().parallel_for(mesh->mNumVertices, 4096, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+          Vertex &vertex = vertices[i];
+          glm::vec3 vector;
+
+          // ---- Positions ----
+          vector.x = mesh->mVertices[i].x;
+          vector.y = mesh->mVertices[i].y;
+          vector.z = mesh->mVertices[i].z;
+          vertex.position = vector;
+
+          // ---- Normals ----
+          if (mesh->HasNormals()) {
+            vector.x = mesh->mNormals[i].x;
+            vector.y = mesh->mNormals[i].y;
+            vector.z = mesh->mNormals[i].z;
+            vertex.normal = vector;
           }
 
-          if (mat->GetTextureCount(aiTextureType_DIFFUSE) > 0) vertex.use_diffuse_texture = 1.0f;
-          else vertex.use_diffuse_texture = 0.0f;
+          // ---- Texture Coordinates ----
+          if (mesh->mTextureCoords[0]) {
+            glm::vec2 vec;
+            vec.x = mesh->mTextureCoords[0][i].x;
+            vec.y = mesh->mTextureCoords[0][i].y;
+            vertex.tex_coords = vec;
+
+            // ---- Tangent ----
+            vector.x = mesh->mTangents[i].x;
+            vector.y = mesh->mTangents[i].y;
+            vector.z = mesh->mTangents[i].z;
+            vertex.tangent = vector;
+
+            // ---- Bitangent ----
+            vector.x = mesh->mBitangents[i].x;
+            vector.y = mesh->mBitangents[i].y;
+            vector.z = mesh->mBitangents[i].z;
+            vertex.bitangent = vector;
+          } else vertex.tex_coords = glm::vec2(0.0f, 0.0f);
+
+          // ---- Unweighted Until The Bone Pass Below ----
+          std::fill(std::begin(vertex.m_bone_ids), std::end(vertex.m_bone_ids), -1);
+          std::fill(std::begin(vertex.m_weights), std::end(vertex.m_weights), 0.0f);
+
+          if (has_material) {
+            if (has_diffuse_color) vertex.color = glm::vec4(diffuse.r, diffuse.g, diffuse.b, diffuse.a);
+            vertex.use_diffuse_texture = use_diffuse_texture;
+          }
+        }
+      });
+
+      // ---- Bone Weights: Keep The Strongest MAX_BONE_INFLUENCE Per Vertex ----
+      for (unsigned int b = 0; b < mesh->mNumBones; b++) {
+        const aiBone *bone = mesh->mBones[b];
+        const std::string name = bone->mName.C_Str();
+        auto [it, inserted] = bone_lookup_.try_emplace(name, static_cast<std::uint32_t>(bone_names_.size()));
+        if (inserted) {
+          bone_names_.push_back(name);
+          skeleton_.inverse_binds.push_back(to_glm(bone->mOffsetMatrix));
         }
 
-        vertices.push_back(vertex);
+        for (unsigned int w = 0; w < bone->mNumWeights; w++) {
+          Vertex &vertex = vertices[bone->mWeights[w].mVertexId];
+          int weakest = 0;
+          for (int slot = 1; slot < MAX_BONE_INFLUENCE; slot++) {
+            if (vertex.m_weights[slot] < vertex.m_weights[weakest]) weakest = slot;
+          }
+          if (bone->mWeights[w].mWeight > vertex.m_weights[weakest]) {
+            vertex.m_bone_ids[weakest] = static_cast<int>(it->second);
+            vertex.m_weights[weakest] = bone->mWeights[w].mWeight;
+          }
+        }
       }
 
       // ---- Walk Through Mesh Faces ----
+      indices.reserve(static_cast<std::size_t>(mesh->mNumFaces) * 3);
       for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
         aiFace face = mesh->mFaces[i];
         for (unsigned int j = 0; j < face.mNumIndices; j++) {
@@ -186,6 +325,14 @@ namespace STARBORN {
     // ---- Model Data ----
     std::vector<Texture> textures_loaded_;
     std::vector<Mesh> meshes_;
+    // Node tree from the file; meshes_[i] hangs off mesh_nodes_[i].
+    TransformHierarchy nodes_;
+    std::vector<std::uint32_t> mesh_nodes_;
+    // Skinned meshes get their placement from the joint palette instead.
+    std::vector<bool> mesh_skinned_;
+    Skeleton skeleton_;
+    std::vector<CompressedClip> clips_;
+    CollisionMesh collision_;
     std::string directory_;
     bool gamma_correction_;
 
@@ -193,9 +340,15 @@ namespace STARBORN {
       load_model(path);
     }
 
-    void draw(Shader &shader) {
-      for (auto & mesh : meshes_) {
-        mesh.draw(shader);
+    // Sets "model" per mesh to `transform` times that mesh's node world
+    // matrix, or to `transform` alone for skinned meshes.
+    void draw(Shader &shader, const glm::mat4 &transform = glm::mat4(1.0f)) {
+      glm::mat4 model;
+      for (std::size_t i = 0; i < meshes_.size(); i++) {
+        if (mesh_skinned_[i]) model = transform;
+        else multiply(transform, nodes_.get_world(mesh_nodes_[i]), model);
+        shader.set_mat4("model", model);
+        meshes_[i].draw(shader);
       }
     }
   };
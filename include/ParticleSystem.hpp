@@ -0,0 +1,125 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "FramePacket.hpp"
+#include "Shader.hpp"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace STARBORN {
+
+// ---- Emitter Settings ----
+struct ParticleEmitterDesc {
+  // Live particles at most; the oldest are recycled first.
+  std::uint32_t capacity = 4096;
+  float lifetime_min = 0.5f;
+  float lifetime_max = 1.0f;
+  float speed_min = 1.0f;
+  float speed_max = 2.0f;
+  // 0 keeps particles on the emission direction; around 1 is a full sphere.
+  float spread = 0.2f;
+  float spawn_radius = 0.0f;
+  glm::vec3 gravity{0.0f};
+  float drag = 0.0f;
+  float size_start = 0.1f;
+  float size_end = 0.0f;
+  glm::vec4 color_start{1.0f};
+  glm::vec4 color_end{1.0f, 1.0f, 1.0f, 0.0f};
+};
+
+// ---- Emitter (Simulation Thread) ----
+// Turns a spawn rate plus bursts into a spawn count per extracted frame.
+// Particles never exist on the CPU, so this costs the same at any count.
+class ParticleEmitter {
+private:
+  std::uint32_t id_;
+  float rate_;
+  float accumulator_ = 0.0f;
+  std::uint32_t burst_ = 0;
+  glm::vec3 position_{0.0f};
+  glm::vec3 direction_{0.0f, 1.0f, 0.0f};
+  bool teleport_ = false;
+public:
+  // ---- Constructor ----
+  // `id` comes from ParticleSystem::add_emitter; `rate` is per second.
+  explicit ParticleEmitter(std::uint32_t id = 0, float rate = 0.0f) : id_(id), rate_(rate) {}
+
+  // ---- Update ----
+  void update(const float delta_time) { accumulator_ += rate_ * delta_time; }
+  void burst(const std::uint32_t count) { burst_ += count; }
+  // Spawns accumulated since the last call, as a packet entry.
+  FramePacket::ParticleEmission extract();
+
+  // ---- Getters ----
+  [[nodiscard]] std::uint32_t get_id() const { return id_; }
+  [[nodiscard]] float get_rate() const { return rate_; }
+  [[nodiscard]] const glm::vec3 &get_position() const { return position_; }
+
+  // ---- Setters ----
+  void set_rate(const float rate) { rate_ = rate; }
+  // `teleport` makes the next spawns start at `position` rather than along
+  // the path from the previous one, e.g. for bursts at a new contact point.
+  void set_position(const glm::vec3 &position, const bool teleport = false) {
+    position_ = position;
+    teleport_ = teleport_ || teleport;
+  }
+  void set_direction(const glm::vec3 &direction) { direction_ = direction; }
+};
+
+// ---- Particle System (Render Thread) ----
+// Each emitter owns two particle buffers. Once per frame a transform
+// feedback pass reads one, respawns a ring window and integrates the rest
+// into the other; the result is drawn as instanced additive billboards, so
+// no sorting is needed. CPU work per emitter is a handful of GL calls.
+class ParticleSystem {
+private:
+  struct Emitter {
+    ParticleEmitterDesc desc;
+    GLuint buffers[2]{};
+    // Same buffers read per vertex (update) and per instance (draw).
+    GLuint update_vaos[2]{};
+    GLuint draw_vaos[2]{};
+    std::uint32_t current = 0;
+    std::uint32_t cursor = 0;
+    glm::vec3 last_position{0.0f};
+    bool placed = false;
+  };
+
+  // ---- Variables ----
+  std::vector<Emitter> emitters_;
+  std::vector<const FramePacket::ParticleEmission *> lookup_;
+  std::unique_ptr<Shader> update_shader_;
+  std::uint32_t frame_ = 0;
+  bool initialized_ = false;
+
+  // ---- Private Methods ----
+  void create_buffers(Emitter &emitter) const;
+  void step(Emitter &emitter, const FramePacket::ParticleEmission *emission);
+public:
+  // ---- Emitters ----
+  // Declare emitters before init() (e.g. in the scene constructor); the
+  // returned id is what ParticleEmitter and the packet refer to.
+  std::uint32_t add_emitter(const ParticleEmitterDesc &desc);
+
+  // ---- Lifecycle ----
+  void init();
+  void cleanup();
+
+  // ---- Frame ----
+  // Advances every emitter by `delta_time`, the packet's frame delta.
+  void simulate(std::span<const FramePacket::ParticleEmission> emissions, float delta_time);
+  // Additive, depth-tested, no depth writes. `shader` is particles.vert/.frag.
+  void draw(const Shader &shader, const glm::mat4 &view, const glm::mat4 &projection) const;
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_emitter_count() const { return emitters_.size(); }
+};
+
+} // STARBORN
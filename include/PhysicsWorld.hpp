@@ -0,0 +1,75 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Broadphase.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace STARBORN {
+
+// Dynamic spheres for debris and projectiles: no gravity, no rotation.
+// Each step integrates, runs the broadphase, tests candidate pairs in
+// parallel and then resolves the contacts in order on the calling thread.
+class PhysicsWorld {
+public:
+  // Normal points from a to b.
+  struct Contact {
+    std::uint32_t a;
+    std::uint32_t b;
+    glm::vec3 normal;
+    float depth;
+    // Relative velocity of b along the normal before resolving; negative
+    // while the bodies approach, about zero for a resting pair.
+    float normal_velocity;
+  };
+private:
+  // ---- Bodies (Indexed Like Their Broadphase Proxy) ----
+  std::vector<glm::vec3> positions_;
+  std::vector<glm::vec3> velocities_;
+  std::vector<float> radii_;
+  // 0 for static bodies.
+  std::vector<float> inverse_masses_;
+
+  // ---- Collision ----
+  Broadphase broadphase_;
+  std::vector<std::vector<Contact>> batch_contacts_;
+  std::vector<Contact> contacts_;
+  float restitution_ = 0.5f;
+
+  // ---- Private Methods ----
+  void integrate(float delta_time);
+  void narrowphase();
+  void resolve();
+public:
+  static constexpr std::size_t NARROWPHASE_GRAIN = 512;
+
+  // ---- Bodies ----
+  // A mass of 0 makes the body static.
+  std::uint32_t create_body(const glm::vec3 &position, float radius, float mass = 1.0f,
+                            const glm::vec3 &velocity = glm::vec3(0.0f));
+  void destroy_body(std::uint32_t body);
+  void clear();
+
+  // ---- Simulation ----
+  // One fixed tick; SceneManager calls this before Scene::update.
+  void step(float delta_time);
+
+  // ---- Getters ----
+  [[nodiscard]] const glm::vec3 &get_position(const std::uint32_t body) const { return positions_[body]; }
+  [[nodiscard]] const glm::vec3 &get_velocity(const std::uint32_t body) const { return velocities_[body]; }
+  // Contacts found by the last step, before they were resolved.
+  [[nodiscard]] const std::vector<Contact> &get_contacts() const { return contacts_; }
+  [[nodiscard]] const Broadphase &get_broadphase() const { return broadphase_; }
+  [[nodiscard]] std::size_t get_body_count() const { return broadphase_.get_proxy_count(); }
+
+  // ---- Setters ----
+  void set_position(std::uint32_t body, const glm::vec3 &position);
+  void set_velocity(const std::uint32_t body, const glm::vec3 &velocity) { velocities_[body] = velocity; }
+  void set_restitution(const float restitution) { restitution_ = restitution; }
+};
+
+} // STARBORN
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Camera.hpp"
+#include "CollisionScene.hpp"
 #include "Input.hpp"
 #include <glm/glm.hpp>
 #include <memory>
@@ -23,9 +24,17 @@ private:
   float speed_;
   float mouse_sensitivity_ = 0.1f;
 
+  // ---- Cursor Position Last Consumed By A Tick ----
+  glm::vec2 last_cursor_{0.0f};
+  bool first_mouse_ = true;
+
+  // ---- State At The Previous Tick (For Interpolation) ----
+  glm::vec3 previous_position_;
+
   // ---- Private Methods ----
   void handle_rotation();
-  void handle_movement(float delta_time);
+  void handle_movement(float delta_time, const STARBORN::CollisionScene *collision);
+  void move_and_slide(glm::vec3 motion, const STARBORN::CollisionScene &collision);
   void update_vectors();
   void sync_camera() const;
 
@@ -37,7 +46,13 @@ public:
                   float pitch = 0.0f, float speed = 2.5f);
 
   // ---- Update ----
-  void update(float delta_time);
+  // One fixed simulation tick. With a collision scene the player is a
+  // capsule around the eye that slides along whatever it walks into.
+  void update(float delta_time, const STARBORN::CollisionScene *collision = nullptr);
+  // Places the camera `alpha` of the way from the previous to the current
+  // tick. Look direction is not interpolated: it takes the latest tick plus
+  // any mouse motion polled since, so aiming never waits for the next tick.
+  void interpolate(float alpha) const;
 
   // ---- Getters ----
   [[nodiscard]] std::shared_ptr<STARBORN::Camera> get_camera() const { return camera_; };
@@ -52,19 +67,13 @@ public:
   // ---- Setters ----
   void set_position(const glm::vec3& position) {
     position_ = position;
+    previous_position_ = position;
     sync_camera();
   };
   void set_sensitivity(float sensitivity) { mouse_sensitivity_ = sensitivity; };
   void set_speed(float speed) { speed_ = speed; };
   void set_aspect_ratio(float aspect_ratio) {
-    if (camera_) {
-      camera_ = std::make_shared<STARBORN::Camera>(
-        position_,
-        position_ + direction_,
-        45.0f, aspect_ratio,
-        0.1f, 100.0f
-      );
-    }
+    if (camera_) camera_->set_aspect_ratio(aspect_ratio);
   }
 };
 
@@ -0,0 +1,80 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "AnimationCompression.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace STARBORN {
+
+// Shares clip evaluation between instances playing the same clip at the
+// same moment (crowds started together, synced loops). Times snap to
+// `time_step`, so instances within one step share a pose; the first one to
+// ask samples and skins, the rest copy. Safe to query from many jobs at
+// once; clear() once per tick before any of them run. Clips are keyed by
+// address, so each clip must only ever be played on its own skeleton.
+class PoseCache {
+public:
+  struct CachedPose {
+    Pose pose;
+    std::vector<glm::mat4> palette;
+  };
+private:
+  struct Entry {
+    std::atomic<bool> ready{false};
+    CachedPose result;
+    std::vector<glm::mat4> joints;
+  };
+
+  struct Key {
+    const CompressedClip *clip = nullptr;
+    std::int64_t step = 0;
+    bool operator==(const Key &) const = default;
+  };
+
+  // Open addressing with linear probing; an empty slot has no entry.
+  struct Slot {
+    Key key;
+    Entry *entry = nullptr;
+  };
+
+  // ---- Variables ----
+  float time_step_;
+  std::mutex mutex_;
+  // Power-of-two size, kept at most half full. clear() empties the slots
+  // but keeps them, and entries are recycled, so steady state never allocates.
+  std::vector<Slot> slots_;
+  int slot_bits_ = 0;
+  std::vector<std::unique_ptr<Entry>> entries_;
+  std::size_t used_ = 0;
+  std::atomic<std::size_t> hits_{0};
+  std::atomic<std::size_t> misses_{0};
+
+  // ---- Private Methods ----
+  Slot &find_slot(const Key &key);
+  void grow();
+public:
+  // ---- Constructor ----
+  explicit PoseCache(float time_step = 1.0f / 120.0f) : time_step_(time_step) {}
+
+  PoseCache(const PoseCache&) = delete;
+  PoseCache& operator=(const PoseCache&) = delete;
+
+  // ---- Cache ----
+  void clear();
+  // `time` must already be wrapped into the clip. Valid until clear().
+  const CachedPose &evaluate(const Skeleton &skeleton, const CompressedClip &clip, float time);
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_hits() const { return hits_.load(std::memory_order_relaxed); }
+  [[nodiscard]] std::size_t get_misses() const { return misses_.load(std::memory_order_relaxed); }
+};
+
+} // STARBORN
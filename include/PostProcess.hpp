@@ -0,0 +1,77 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "ShaderVariants.hpp"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace STARBORN {
+
+// Single fused post pass. Enabled effects are compiled into one shader
+// variant, color quantization is a lookup into a precomputed 3D palette
+// LUT, and dithering reads an 8x8 Bayer threshold texture. The pass also
+// upsamples when the scene was rendered into a sub-region of its target.
+class PostProcess {
+public:
+  // ---- Effects ----
+  enum Effect : std::uint32_t {
+    QUANTIZE = 1u << 0,
+    DITHER = 1u << 1,
+    SHARPEN = 1u << 2,
+  };
+private:
+  // ---- Variables ----
+  ShaderVariants shaders_;
+  std::uint32_t effects_ = QUANTIZE | DITHER;
+  unsigned int palette_lut_{}, dither_texture_{};
+  int color_levels_ = 8;
+  float quantize_intensity_ = 0.8f;
+  float dither_intensity_ = 1.0f;
+  float sharpen_strength_ = 0.5f;
+  glm::ivec2 source_size_{1, 1};
+  glm::ivec2 region_size_{1, 1};
+
+  // ---- Dirty Tracking ----
+  bool lut_dirty_ = true;
+  bool uniforms_dirty_ = true;
+  unsigned int last_program_{};
+
+  // ---- Private Methods ----
+  void build_palette_lut();
+  void build_dither_texture();
+public:
+  static constexpr int LUT_SIZE = 32;
+
+  // ---- Constructor & Destructor ----
+  PostProcess();
+  ~PostProcess() = default;
+
+  // ---- Lifecycle ----
+  void init();
+  void cleanup();
+
+  // ---- Draw ----
+  // Draws `source_texture` to the currently bound framebuffer.
+  void apply(unsigned int source_texture);
+
+  // ---- Setters ----
+  void set_effects(std::uint32_t effects);
+  // Builds a variant in the background so switching to it later is seamless.
+  void prewarm(std::uint32_t effects);
+  void set_quantize(int color_levels, float intensity);
+  void set_dither(float intensity);
+  void set_sharpen(float strength);
+  // The source texture is `source_size` but only `region_size` (from the
+  // bottom-left corner) holds the image, e.g. under dynamic resolution.
+  void set_source_region(const glm::ivec2 &source_size, const glm::ivec2 &region_size);
+
+  // ---- Getters ----
+  [[nodiscard]] std::uint32_t get_effects() const { return effects_; }
+  [[nodiscard]] int get_color_levels() const { return color_levels_; }
+};
+
+} // STARBORN
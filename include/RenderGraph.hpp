@@ -0,0 +1,106 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "FrameBuffer.hpp"
+#include "RenderTargetPool.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// Per-frame graph of render passes. Passes declare which virtual textures
+// they create, read and write; compile() culls passes whose results never
+// reach an imported target and computes each texture's lifetime, and
+// execute() backs transient textures with pooled targets for exactly that
+// lifetime. After each pass, written targets are resolved (MSAA) and
+// attachments no later pass renders into are invalidated. Passes run in declaration order, which is always a valid order
+// because a pass can only read textures declared before it.
+class RenderGraph {
+public:
+  // ---- Handles ----
+  struct TextureHandle {
+    int index = -1;
+    [[nodiscard]] bool is_valid() const { return index >= 0; }
+  };
+
+  // ---- Setup ----
+  class Builder {
+  private:
+    RenderGraph &graph_;
+    int pass_;
+  public:
+    Builder(RenderGraph &graph, int pass) : graph_(graph), pass_(pass) {}
+
+    TextureHandle create(const std::string &name, const RenderTargetDesc &desc);
+    TextureHandle read(TextureHandle texture);
+    TextureHandle write(TextureHandle texture);
+    // Never cull this pass (e.g. it has effects outside the graph).
+    void side_effect();
+  };
+
+  // ---- Execution ----
+  class Resources {
+  private:
+    const RenderGraph &graph_;
+  public:
+    explicit Resources(const RenderGraph &graph) : graph_(graph) {}
+
+    // Binds the target and sets the viewport to its size.
+    void bind(TextureHandle texture) const;
+    [[nodiscard]] FrameBuffer* get_frame_buffer(TextureHandle texture) const;
+    [[nodiscard]] unsigned int get_texture_id(TextureHandle texture) const;
+  };
+
+  using SetupFunction = std::function<void(Builder &)>;
+  using ExecuteFunction = std::function<void(const Resources &)>;
+private:
+  struct Texture {
+    std::string name;
+    RenderTargetDesc desc{};
+    bool imported = false;
+    FrameBuffer *frame_buffer = nullptr;
+    std::vector<int> writers;
+    int first_use = -1;
+    int last_use = -1;
+    int last_write = -1;
+  };
+
+  struct Pass {
+    std::string name;
+    ExecuteFunction execute;
+    std::vector<int> reads;
+    std::vector<int> writes;
+    bool side_effect = false;
+    int ref_count = 0;
+    bool culled = false;
+  };
+
+  // ---- Internal State ----
+  std::vector<Texture> textures_;
+  std::vector<Pass> passes_;
+  bool compiled_ = false;
+
+  // ---- Private Methods ----
+  void use(int texture, int pass);
+public:
+  // ---- Building ----
+  // External targets (e.g. the default framebuffer as nullptr) keep every
+  // pass that contributes to them alive.
+  TextureHandle import_target(const std::string &name, FrameBuffer *frame_buffer, const RenderTargetDesc &desc);
+  void add_pass(const std::string &name, const SetupFunction &setup, ExecuteFunction execute);
+
+  // ---- Frame ----
+  void compile();
+  void execute(RenderTargetPool &pool = RenderTargetPool::get_instance());
+  void reset();
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_pass_count() const { return passes_.size(); }
+  [[nodiscard]] std::size_t get_culled_count() const;
+};
+
+} // STARBORN
@@ -0,0 +1,53 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "FrameBuffer.hpp"
+#include "FramePacer.hpp"
+#include <string>
+
+namespace STARBORN {
+
+// Per-deployment rendering options, read from JSON so quality vs.
+// bandwidth can be chosen without recompiling. Missing keys keep defaults.
+struct RenderSettings {
+  // ---- Scene Target ----
+  int msaa_samples = 1;
+  bool hdr = false;
+  // Reverse-Z with an infinite far plane and a float depth buffer. Needs
+  // glClipControl (GL 4.5 / ARB_clip_control); cleared when unavailable.
+  bool reverse_z = true;
+
+  // ---- Presentation ----
+  std::string present_mode = "vsync";
+  double frame_rate_cap = 60.0;
+  int max_frames_in_flight = 2;
+
+  // ---- Simulation ----
+  double tick_rate = 60.0;
+  int max_catch_up_steps = 5;
+
+  // ---- Threading ----
+  // Off runs GL on the main thread, which is easier to debug.
+  bool render_thread = true;
+
+  // ---- Development ----
+  // Watches shader sources and rebuilds on change. Off in release builds
+  // unless the file turns it on.
+#ifdef NDEBUG
+  bool shader_hot_reload = false;
+#else
+  bool shader_hot_reload = true;
+#endif
+
+  // ---- Loading ----
+  static RenderSettings load(const std::string &path);
+
+  // ---- Derived ----
+  [[nodiscard]] FrameBufferDesc scene_target() const;
+  [[nodiscard]] FramePacer::Config frame_pacing() const;
+};
+
+} // STARBORN
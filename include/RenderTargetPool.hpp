@@ -0,0 +1,68 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "FrameBuffer.hpp"
+#include <memory>
+#include <vector>
+
+namespace STARBORN {
+
+struct RenderTargetDesc {
+  int width;
+  int height;
+  FrameBufferDesc format{};
+
+  bool operator==(const RenderTargetDesc &) const = default;
+};
+
+// Physical render targets shared by transient RenderGraph textures. A
+// target released by one pass can be handed to a later pass in the same
+// frame, so textures with disjoint lifetimes alias the same memory.
+class RenderTargetPool {
+private:
+  // ---- Constructor & Destructor ----
+  RenderTargetPool() = default;
+  ~RenderTargetPool() = default;
+
+  struct Slot {
+    std::unique_ptr<FrameBuffer> frame_buffer;
+    RenderTargetDesc desc;
+    bool in_use = false;
+    int idle_frames = 0;
+  };
+
+  // ---- Internal State ----
+  std::vector<Slot> slots_;
+public:
+  // ---- Singleton Instance ----
+  static RenderTargetPool& get_instance() {
+    static RenderTargetPool instance;
+    return instance;
+  }
+
+  RenderTargetPool(const RenderTargetPool&) = delete;
+  RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+  // Targets unused for this many frames are destroyed.
+  static constexpr int MAX_IDLE_FRAMES = 3;
+
+  // ---- Allocation ----
+  FrameBuffer* acquire(const RenderTargetDesc &desc);
+  void release(const FrameBuffer *frame_buffer);
+
+  // ---- Maintenance ----
+  void end_frame();
+  // Resizes targets of the old screen size in place, so the next frame
+  // reuses them instead of allocating new ones and evicting the old.
+  void resize(int old_width, int old_height, int width, int height);
+  // Must run while the GL context is still current.
+  void clear();
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_size() const { return slots_.size(); }
+};
+
+} // STARBORN
@@ -0,0 +1,78 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "FramePacket.hpp"
+#include <GLFW/glfw3.h>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace STARBORN {
+
+// Owns the GL context on a dedicated thread. The simulation fills a
+// FramePacket and submit()s it; the render thread draws it while the
+// simulation builds the next one (one frame of pipelining). Anything
+// else that touches GL, such as loading or scene init, goes through execute().
+class RenderThread {
+public:
+  using FrameCallback = std::function<void(const FramePacket &)>;
+  using Command = std::function<void()>;
+private:
+  // ---- Variables ----
+  GLFWwindow *window_ = nullptr;
+  FrameCallback render_frame_;
+  bool threaded_ = false;
+  std::thread thread_;
+  std::thread::id render_thread_id_;
+
+  // ---- Shared State (Guarded By mutex_) ----
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable consumed_;
+  std::vector<Command> commands_;
+  FramePacket pending_;
+  bool packet_ready_ = false;
+  bool stopping_ = false;
+  std::exception_ptr error_;
+
+  // ---- Render Thread Only ----
+  FramePacket current_;
+  std::vector<Command> running_commands_;
+
+  // ---- Private Methods ----
+  void run();
+  void rethrow_error();
+public:
+  // ---- Constructor & Destructor ----
+  RenderThread() = default;
+  ~RenderThread();
+
+  RenderThread(const RenderThread&) = delete;
+  RenderThread& operator=(const RenderThread&) = delete;
+
+  // ---- Lifecycle ----
+  // Hands the window's context to the render thread. With `threaded` off
+  // everything runs inline on the caller, which keeps the context.
+  void start(GLFWwindow *window, FrameCallback render_frame, bool threaded = true);
+  // Drains queued work, joins, and makes the context current on the caller again.
+  void stop();
+
+  // ---- Submission ----
+  // Blocks until the previous packet has been picked up, then swaps `packet`
+  // for a recycled one the caller can clear and refill.
+  void submit(FramePacket &packet);
+  // Runs `command` on the render thread between frames and waits for it.
+  // Exceptions thrown by the command are rethrown here.
+  void execute(Command command);
+
+  // ---- Getters ----
+  [[nodiscard]] bool is_threaded() const { return threaded_; }
+};
+
+} // STARBORN
@@ -0,0 +1,72 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace STARBORN {
+
+// Bounded lock-free ring for exactly one producer thread and one consumer
+// thread. Head and tail sit on separate cache lines so the two sides do
+// not false-share; each side caches the other's index and only reloads
+// it when the ring looks full or empty.
+template <typename T, std::size_t Capacity>
+class SPSCQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+private:
+  static constexpr std::size_t MASK = Capacity - 1;
+
+  // ---- Producer Side ----
+  alignas(64) std::atomic<std::size_t> tail_{0};
+  std::size_t cached_head_ = 0;
+
+  // ---- Consumer Side ----
+  alignas(64) std::atomic<std::size_t> head_{0};
+  std::size_t cached_tail_ = 0;
+
+  alignas(64) std::array<T, Capacity> buffer_{};
+public:
+  // ---- Producer ----
+  // Returns false, dropping `value`, when the ring is full.
+  bool push(const T &value) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == Capacity) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == Capacity) return false;
+    }
+
+    buffer_[tail & MASK] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // ---- Consumer ----
+  bool pop(T &value) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) return false;
+    }
+
+    value = buffer_[head & MASK];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Pops everything available right now into `consume(const T&)`.
+  template <typename Consume>
+  std::size_t drain(Consume &&consume) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+
+    for (std::size_t i = head; i != cached_tail_; i++) consume(buffer_[i & MASK]);
+    head_.store(cached_tail_, std::memory_order_release);
+    return cached_tail_ - head;
+  }
+};
+
+} // STARBORN
@@ -4,17 +4,30 @@
 
 #pragma once
 
+#include "FramePacket.hpp"
+
 namespace STARBORN {
+  class PhysicsWorld;
+
   class Scene {
   public:
     virtual ~Scene() = default;
+    // Runs on the render thread; create GL resources here.
     virtual void init() = 0;
+    // Called once per fixed simulation tick.
     virtual void update(float delta_time) = 0;
-    virtual void render() = 0;
+    // Simulation thread: capture what to draw into `packet`. `alpha` is how
+    // far (0..1) the frame lies between the last two ticks.
+    virtual void extract(FramePacket &packet, float alpha) = 0;
+    // Render thread: draw from the packet only, never from simulation state.
+    virtual void render(const FramePacket &packet) = 0;
     virtual void cleanup() = 0;
+    // Stepped by the SceneManager each fixed tick, before update().
+    virtual PhysicsWorld *get_physics() { return nullptr; }
 
     // ---- Lifecycle ----
     virtual void on_enter() = 0;
     virtual void on_exit() = 0;
+    virtual void on_resize(int width, int height) = 0;
   };
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Scene.hpp"
+#include "RenderThread.hpp"
 #include <unordered_map>
 #include <memory>
 #include <string>
@@ -17,8 +18,10 @@ namespace STARBORN {
     Scene *active_scene_;
     Scene *next_scene_;
     bool transitioning_;
+    RenderThread *render_thread_ = nullptr;
 
     SceneManager();
+    void run_on_render_thread(const RenderThread::Command &command) const;
   public:
     // ---- Singleton Instance ----
     SceneManager(const SceneManager &) = delete;
@@ -34,10 +37,14 @@ namespace STARBORN {
     void add_scene(const std::string &name, std::unique_ptr<Scene> scene);
     bool remove_scene(const std::string &name);
     void set_active_scene(const std::string &name);
+    // Scene init and cleanup touch GL, so they are routed through this thread.
+    void set_render_thread(RenderThread *render_thread) { render_thread_ = render_thread; }
 
     // ---- Scene Methods ----
     void update(float delta_time);
-    void render() const;
+    void extract(FramePacket &packet, float alpha) const;
+    static void render(const FramePacket &packet);
+    void resize(int width, int height) const;
     void cleanup();
 
     // ---- Getters ----
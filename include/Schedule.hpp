@@ -0,0 +1,50 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "World.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// Runs ECS systems in the order they were added, but groups neighbours
+// whose component access doesn't conflict into batches that go to the job
+// system together. Two systems conflict when either one writes a component
+// the other reads or writes. Systems may use parallel views internally;
+// they must not make structural changes to the world.
+class Schedule {
+public:
+  using System = std::function<void(World &, float)>;
+private:
+  struct Entry {
+    std::string name;
+    ComponentMask reads;
+    ComponentMask writes;
+    System system;
+  };
+
+  // ---- Variables ----
+  std::vector<Entry> systems_;
+  // Indices into systems_, rebuilt lazily after add().
+  std::vector<std::vector<std::size_t>> batches_;
+  bool dirty_ = false;
+
+  // ---- Private Methods ----
+  void build_batches();
+  [[nodiscard]] static bool conflicts(const Entry &a, const Entry &b);
+public:
+  // ---- Systems ----
+  void add(std::string name, ComponentMask reads, ComponentMask writes, System system);
+  void clear();
+  void run(World &world, float delta_time);
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_system_count() const { return systems_.size(); }
+  [[nodiscard]] std::size_t get_batch_count();
+};
+
+} // STARBORN
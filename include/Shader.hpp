@@ -6,18 +6,34 @@
 
 #include <glad/glad.h>
 
+#include <cstdint>
 #include <fstream>
 #include <glm/glm.hpp>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace STARBORN {
 
 class Shader {
 private:
-  std::string read_shader_file(const char *file_path) const;
+  // ---- Build State ----
+  std::string vertex_path_;
+  std::string fragment_path_;
+  std::vector<std::string> defines_;
+  std::vector<std::string> dependencies_;
+  std::vector<std::string> feedback_varyings_;
+  unsigned int pending_vertex_{};
+  unsigned int pending_fragment_{};
+  std::uint64_t cache_key_{};
+  bool submitted_ = false;
+  bool ready_ = false;
+  bool source_fallback_ = true;
+
+  std::string read_shader_file(const char *file_path);
   static unsigned int compile_shader(const char *shader_code, GLenum shader_type);
+  static void check_shader(unsigned int shader, const char *stage);
   void create_shader_program(unsigned int vertex, unsigned int fragment);
   static bool ends_with(const std::string& str, const std::string& suffix);
 public:
@@ -26,9 +42,43 @@ public:
   std::string SHADER_FAIL = "FAIL";
 
   // ---- Constructor & Destructor ----
-  Shader(const char* vertex_path, const char* fragment_path);
+  // A deferred shader only records its paths; call submit() and finalize()
+  // (or let ShaderLibrary do it) so several programs can compile in parallel.
+  Shader(const char* vertex_path, const char* fragment_path, bool deferred = false);
+  // Builds a variant with `defines` injected after #version, e.g. {"APPLY_DITHER", "COLOR_LEVELS 8"}.
+  Shader(const char* vertex_path, const char* fragment_path, const std::vector<std::string>& defines,
+         bool deferred = false);
   ~Shader();
 
+  Shader(const Shader&) = delete;
+  Shader& operator=(const Shader&) = delete;
+
+  // ---- Build ----
+  // Issues compile and link without querying their status.
+  void submit();
+  // Non-blocking when KHR_parallel_shader_compile is available.
+  [[nodiscard]] bool is_ready() const;
+  // Blocks until the program is linked; throws with the info log on failure.
+  void finalize();
+  [[nodiscard]] bool is_finalized() const { return ready_; }
+  // Outputs captured (interleaved) by transform feedback; set before submit().
+  void set_feedback_varyings(const std::vector<std::string> &varyings) { feedback_varyings_ = varyings; }
+
+  // ---- Hot Reload ----
+  // Without the fallback sources an unreadable file makes submit() throw,
+  // so a rebuild of a half-saved file fails instead of linking basic.*.
+  void set_source_fallback(const bool enabled) { source_fallback_ = enabled; }
+  // Takes over the program of a finalized rebuild of this shader; `other`
+  // ends up owning (and later deleting) the previous program.
+  void swap_program(Shader &other);
+
+  // ---- Getters ----
+  [[nodiscard]] const std::string& get_vertex_path() const { return vertex_path_; }
+  [[nodiscard]] const std::string& get_fragment_path() const { return fragment_path_; }
+  // Source files (including #include'd ones) read by the last submit().
+  [[nodiscard]] const std::vector<std::string>& get_dependencies() const { return dependencies_; }
+  [[nodiscard]] const std::vector<std::string>& get_defines() const { return defines_; }
+
   // --- Activate Shader ----
   void use() const { glUseProgram(ID); };
 
@@ -39,6 +89,9 @@ public:
   void set_int(const std::string& name, const int value) const {
     glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
   };
+  void set_uint(const std::string& name, const unsigned int value) const {
+    glUniform1ui(glGetUniformLocation(ID, name.c_str()), value);
+  };
   void set_float(const std::string& name, const float value) const {
     glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
   };
@@ -0,0 +1,58 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace STARBORN {
+
+class ShaderCache {
+private:
+  // ---- Constructor & Destructor ----
+  ShaderCache() = default;
+  ~ShaderCache() = default;
+
+  // ---- Internal State ----
+  std::filesystem::path directory_ = "cache/shaders";
+  std::string driver_id_;
+  bool initialized_ = false;
+  bool supported_ = false;
+
+  // ---- Private Methods ----
+  void init();
+  [[nodiscard]] std::filesystem::path path_for(std::uint64_t key) const;
+public:
+  // ---- Singleton Instance ----
+  static ShaderCache& get_instance() {
+    static ShaderCache instance;
+    if (!instance.initialized_) instance.init();
+    return instance;
+  }
+
+  ShaderCache(const ShaderCache&) = delete;
+  ShaderCache& operator=(const ShaderCache&) = delete;
+
+  // ---- Keys ----
+  // Hashes the sources, defines and driver identity so a driver update or
+  // any source edit produces a new key and stale binaries are never loaded.
+  [[nodiscard]] std::uint64_t make_key(const std::string &vertex_code, const std::string &fragment_code,
+                                       const std::string &defines = "") const;
+
+  // ---- Program Binaries ----
+  // Marks a program as retrievable. Call between glCreateProgram and glLinkProgram.
+  void prepare(unsigned int program) const;
+  // Returns true if `program` was linked from a cached binary.
+  bool load(std::uint64_t key, unsigned int program) const;
+  void store(std::uint64_t key, unsigned int program) const;
+
+  // ---- Getters & Setters ----
+  void set_directory(const std::filesystem::path &directory) { directory_ = directory; }
+  [[nodiscard]] bool is_supported() const { return supported_; }
+};
+
+} // STARBORN
@@ -0,0 +1,83 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Shader.hpp"
+#include "FileWatcher.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace STARBORN {
+
+class ShaderLibrary {
+private:
+  // ---- Constructor & Destructor ----
+  ShaderLibrary() = default;
+  ~ShaderLibrary() = default;
+
+  struct Entry {
+    std::unique_ptr<Shader> shader;
+    std::unique_ptr<Shader> staging;
+    std::string fallback;
+    bool failed = false;
+    bool watched = false;
+  };
+
+  // ---- Internal State ----
+  std::unordered_map<std::string, Entry> entries_;
+  std::vector<std::string> queued_;
+  std::vector<std::string> pending_;
+  std::unique_ptr<FileWatcher> watcher_;
+
+  // ---- Private Methods ----
+  void finalize_entry(const std::string &name, Entry &entry);
+  void watch_entry(Entry &entry);
+  void start_reloads();
+  void poll_reloads();
+public:
+  // ---- Singleton Instance ----
+  static ShaderLibrary& get_instance() {
+    static ShaderLibrary instance;
+    return instance;
+  }
+
+  ShaderLibrary(const ShaderLibrary&) = delete;
+  ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+  // ---- Requests ----
+  // Queues a program; nothing is compiled until compile_all(). While it is
+  // still building, get() returns the `fallback` program instead.
+  void request(const std::string &name, const char *vertex_path, const char *fragment_path,
+               const std::string &fallback = "", const std::vector<std::string> &defines = {});
+  // Submits every queued program to the driver in one batch.
+  void compile_all();
+
+  // ---- Completion ----
+  // Finalizes programs the driver has finished. Call once per frame.
+  void poll();
+  // Blocks until `name` is linked.
+  void finish(const std::string &name);
+  void finish_all();
+
+  // ---- Hot Reload ----
+  // Watches every source file (and #include) of finished programs. Edited
+  // programs are rebuilt in the background from poll() and swapped in once
+  // linked; a failed rebuild logs and keeps the previous program.
+  void set_hot_reload(bool enabled);
+
+  // ---- Access ----
+  Shader& get(const std::string &name);
+  [[nodiscard]] bool is_ready(const std::string &name) const;
+  [[nodiscard]] bool contains(const std::string &name) const { return entries_.contains(name); }
+  [[nodiscard]] bool is_complete() const { return queued_.empty() && pending_.empty(); }
+
+  // ---- Cleanup ----
+  // Must run while the GL context is still current.
+  void clear();
+};
+
+} // STARBORN
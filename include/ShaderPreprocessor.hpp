@@ -0,0 +1,28 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+  namespace ShaderPreprocessor {
+    // ---- Result ----
+    struct Source {
+      std::string code;
+      // Every file that contributed to `code`, root first. Empty code means the root could not be read.
+      std::vector<std::string> dependencies;
+    };
+
+    // Resolves `#include "file"` relative to the including file (each file
+    // is included at most once) and injects `#define` lines for `defines`
+    // directly after the `#version` directive. A define may carry a value,
+    // e.g. "COLOR_LEVELS 8".
+    [[nodiscard]] Source process(const std::string &path, const std::vector<std::string> &defines = {});
+
+    // Newline-joined `#define` block, also used as part of cache keys.
+    [[nodiscard]] std::string define_block(const std::vector<std::string> &defines);
+  }
+}
@@ -0,0 +1,48 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Shader.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace STARBORN {
+
+// Compiles one program per feature combination instead of branching on
+// uniforms per pixel. Bit i of a mask enables `#define features[i]`.
+// Variants live in ShaderLibrary under "<name>#<mask>", plus a hash of
+// the shared defines once set_defines() has been called, and are built on
+// first use; until then get() returns the fallback program.
+class ShaderVariants {
+private:
+  std::string name_;
+  std::string vertex_path_;
+  std::string fragment_path_;
+  std::vector<std::string> features_;
+  std::vector<std::string> extra_defines_;
+  // Suffix of every variant name, so a define change maps to new library entries.
+  std::string defines_key_;
+  std::string fallback_;
+
+  [[nodiscard]] std::string variant_name(std::uint32_t mask) const;
+public:
+  // ---- Constructor ----
+  ShaderVariants(std::string name, std::string vertex_path, std::string fragment_path,
+                 std::vector<std::string> features, std::string fallback = "");
+
+  // ---- Variants ----
+  // Only queues the variant; call ShaderLibrary::compile_all() once after
+  // queuing a batch so every queued program is submitted together.
+  void request(std::uint32_t mask);
+  Shader& get(std::uint32_t mask);
+  [[nodiscard]] bool is_ready(std::uint32_t mask) const;
+
+  // ---- Setters ----
+  // Defines shared by every variant, e.g. {"COLOR_LEVELS 8"}. Applies to variants requested afterwards.
+  void set_defines(const std::vector<std::string> &defines);
+};
+
+} // STARBORN
@@ -0,0 +1,35 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Animation.hpp"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <span>
+
+namespace STARBORN {
+
+// Uniform buffer holding one joint palette (std140 mat4 array), bound to a
+// fixed binding point that skinned shaders attach their Skinning block to.
+// Render thread only.
+class SkinningBuffer {
+public:
+  static constexpr GLuint BINDING = 0;
+private:
+  // ---- Variables ----
+  GLuint ubo_ = 0;
+public:
+  // ---- Lifecycle ----
+  void init();
+  void cleanup();
+
+  // ---- Upload ----
+  // At most MAX_JOINTS matrices; the rest are ignored.
+  void upload(std::span<const glm::mat4> palette) const;
+  // Points `program`'s Skinning block at BINDING (GL 3.3 has no layout(binding)).
+  static void attach(GLuint program);
+};
+
+} // STARBORN
@@ -6,34 +6,67 @@
 
 #include "Scene.hpp"
 #include "Window.hpp"
-#include "Shader.hpp"
+#include "ShaderLibrary.hpp"
+#include "PostProcess.hpp"
 #include "Model.hpp"
 #include "Player.hpp"
 #include "ScreenQuad.hpp"
-#include "FrameBuffer.hpp"
+#include "RenderGraph.hpp"
+#include "DynamicResolution.hpp"
+#include "RenderSettings.hpp"
+#include "World.hpp"
+#include "Schedule.hpp"
+#include "TransformHierarchy.hpp"
+#include "Animation.hpp"
+#include "SkinningBuffer.hpp"
+#include "PoseCache.hpp"
+#include "CollisionScene.hpp"
+#include "PhysicsWorld.hpp"
+#include "ParticleSystem.hpp"
 #include <memory>
+#include <vector>
 
 namespace STARMAN {
   class TestScene : public STARBORN::Scene {
   private:
-    STARBORN::Shader shader_;
-    std::unique_ptr<STARBORN::Shader> post_processing_shader_;
+    STARBORN::PostProcess post_process_;
     STARBORN::Model test_model_;
     Player player_;
-    std::unique_ptr<STARBORN::FrameBuffer> frame_buffer_;
-    STARBORN::Window window_;
+    STARBORN::RenderGraph render_graph_;
+    STARBORN::DynamicResolution dynamic_resolution_;
+    STARBORN::RenderSettings render_settings_;
+    STARBORN::World world_;
+    STARBORN::TransformHierarchy transforms_;
+    std::vector<STARBORN::Animator> animators_;
+    STARBORN::PoseCache pose_cache_;
+    STARBORN::SkinningBuffer skinning_buffer_;
+    STARBORN::Schedule schedule_;
+    STARBORN::CollisionScene collision_;
+    STARBORN::PhysicsWorld physics_;
+    STARBORN::ParticleSystem particles_;
+    STARBORN::ParticleEmitter thruster_;
+    STARBORN::ParticleEmitter sparks_;
+    float elapsed_ = 0.0f;
 
   public:
     // ---- Constructor & Destructor ----
-    explicit TestScene(const STARBORN::Window &window);
+    // `settings` is the RenderSettings main() loaded; the scene keeps a copy.
+    TestScene(const STARBORN::Window &window, const STARBORN::RenderSettings &settings);
     ~TestScene() override = default;
 
     // ---- Scene Methods ----
     void init() override;
     void update(float delta_time) override;
-    void render() override;
+    void extract(STARBORN::FramePacket &packet, float alpha) override;
+    void render(const STARBORN::FramePacket &packet) override;
     void cleanup() override;
+    STARBORN::PhysicsWorld *get_physics() override { return &physics_; }
     void on_enter() override;
     void on_exit() override;
+    void on_resize(int width, int height) override;
+
+  private:
+    // ---- Passes ----
+    void render_scene(const STARBORN::FramePacket &packet);
   };
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "Components.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace STARBORN {
+
+// Flat transform tree stored parent-before-child, so a single forward walk
+// sees every parent's world matrix before its children need it. Setters
+// only flag the node; update() propagates the flags down the tree and
+// rebuilds local and world matrices for the changed nodes alone.
+class TransformHierarchy {
+public:
+  static constexpr std::uint32_t NO_PARENT = 0xffffffffu;
+private:
+  enum Flags : std::uint8_t {
+    LOCAL_DIRTY = 1 << 0,
+    WORLD_DIRTY = 1 << 1,
+  };
+
+  // ---- Variables ----
+  std::vector<std::uint32_t> parents_;
+  std::vector<Transform> locals_;
+  std::vector<glm::mat4> local_matrices_;
+  std::vector<glm::mat4> world_matrices_;
+  std::vector<std::uint8_t> flags_;
+  // Nodes rebuilt by the last update(), in parent-before-child order.
+  std::vector<std::uint32_t> changed_;
+  // Nothing before this index is dirty.
+  std::uint32_t first_dirty_ = 0;
+
+  // ---- Private Methods ----
+  void mark_dirty(std::uint32_t node);
+public:
+  // ---- Nodes ----
+  // `parent` must already exist, which is what keeps the order valid.
+  std::uint32_t add(std::uint32_t parent, const Transform &local = {});
+  void reserve(std::size_t count);
+  void clear();
+
+  // ---- Update ----
+  void update();
+
+  // ---- Getters ----
+  [[nodiscard]] const Transform &get_local(const std::uint32_t node) const { return locals_[node]; }
+  [[nodiscard]] const glm::mat4 &get_world(const std::uint32_t node) const { return world_matrices_[node]; }
+  [[nodiscard]] std::uint32_t get_parent(const std::uint32_t node) const { return parents_[node]; }
+  [[nodiscard]] std::span<const std::uint32_t> get_changed() const { return changed_; }
+  [[nodiscard]] std::size_t size() const { return parents_.size(); }
+
+  // ---- Setters ----
+  void set_local(std::uint32_t node, const Transform &local);
+  void set_position(std::uint32_t node, const glm::vec3 &position);
+  void set_rotation(std::uint32_t node, const glm::quat &rotation);
+  void set_scale(std::uint32_t node, const glm::vec3 &scale);
+};
+
+// ---- Matrix Helpers ----
+glm::mat4 compose(const Transform &transform);
+// out = a * b, four columns at a time where SSE is available. `out` may alias `b`.
+void multiply(const glm::mat4 &a, const glm::mat4 &b, glm::mat4 &out);
+
+} // STARBORN
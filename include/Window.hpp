@@ -6,6 +6,8 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <atomic>
+#include <cstdint>
 
 namespace STARBORN {
 
@@ -17,17 +19,34 @@ private:
   const char *title_;
   GLFWwindow *window_{};
 
+  // ---- Pending Resize ----
+  // Written by the GLFW callback on the event thread, applied once per
+  // frame by consume_resize() on the simulation thread. Width and height
+  // share one word so they are always read as a pair.
+  std::atomic<std::uint64_t> pending_size_;
+  std::atomic<bool> resize_pending_{false};
+
   // ---- Private Methods ----
   static void init_GLFW();
   void init_GLAD();
   void create_window();
   void set_viewport() const;
+  void sync_framebuffer_size();
+  void set_pending_size(int width, int height);
   static void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 public:
   // ---- Constructor & Destructor ----
   Window(int width, int height, const char *title);
   ~Window();
 
+  Window(const Window&) = delete;
+  Window& operator=(const Window&) = delete;
+
+  // ---- Resize ----
+  // Applies the latest size reported since the last call, coalescing a drag
+  // into one resize. Returns false if nothing changed or the window is minimized.
+  bool consume_resize();
+
   // ---- Setters & Getters ----
   void set_title(const char *title) { title_ = title; }
   void set_size(const int width, const int height) { width_ = width; height_ = height; }
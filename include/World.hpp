@@ -0,0 +1,273 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#pragma once
+
+#include "JobSystem.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace STARBORN {
+
+// ---- Entity Handle ----
+// The generation changes every time an index is reused, so a handle to a
+// destroyed entity never silently resolves to its replacement.
+struct Entity {
+  static constexpr std::uint32_t INVALID = 0xffffffffu;
+
+  std::uint32_t index = INVALID;
+  std::uint32_t generation = 0;
+
+  [[nodiscard]] bool is_valid() const { return index != INVALID; }
+  bool operator==(const Entity &) const = default;
+};
+
+// ---- Component Types ----
+using ComponentMask = std::uint64_t;
+constexpr std::uint32_t MAX_COMPONENTS = 64;
+
+struct ComponentInfo {
+  std::uint32_t id;
+  std::uint32_t size;
+  std::uint32_t alignment;
+};
+
+// Components are plain data: they are moved between chunks with memcpy
+// and never have their destructors run.
+template <typename T>
+concept Component = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+std::uint32_t next_component_id();
+
+template <Component T>
+std::uint32_t component_id() {
+  static const std::uint32_t id = next_component_id();
+  return id;
+}
+
+template <Component T>
+ComponentInfo component_info() {
+  return {component_id<T>(), static_cast<std::uint32_t>(sizeof(T)), static_cast<std::uint32_t>(alignof(T))};
+}
+
+template <Component... Ts>
+ComponentMask component_mask() {
+  return (ComponentMask{0} | ... | (ComponentMask{1} << component_id<Ts>()));
+}
+
+// ---- Archetype ----
+// All entities with exactly the same component set. Rows live in fixed-size
+// chunks laid out as structure-of-arrays: the entity column first, then one
+// tightly packed array per component, so a view walks contiguous memory.
+class Archetype {
+public:
+  static constexpr std::size_t CHUNK_BYTES = 16 * 1024;
+
+  struct Chunk {
+    alignas(64) std::byte data[CHUNK_BYTES];
+    std::uint32_t count = 0;
+  };
+private:
+  // ---- Layout ----
+  ComponentMask mask_;
+  std::vector<ComponentInfo> components_;
+  std::vector<std::size_t> offsets_;
+  std::array<std::int8_t, MAX_COMPONENTS> columns_{};
+  std::uint32_t capacity_ = 0;
+
+  // ---- Storage ----
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+  std::uint32_t size_ = 0;
+public:
+  // ---- Constructor ----
+  Archetype(ComponentMask mask, std::vector<ComponentInfo> components);
+
+  // ---- Rows ----
+  // Appends an uninitialised row for `entity` and returns its index.
+  std::uint32_t push_row(Entity entity);
+  // Swap-removes `row`; returns the entity moved into it, if any.
+  Entity remove_row(std::uint32_t row);
+
+  // ---- Access ----
+  [[nodiscard]] std::byte *component(std::uint32_t row, std::uint32_t id) const;
+  [[nodiscard]] Entity entity(std::uint32_t row) const;
+  [[nodiscard]] bool has(const std::uint32_t id) const { return columns_[id] >= 0; }
+  [[nodiscard]] const std::vector<ComponentInfo> &get_components() const { return components_; }
+
+  template <Component T>
+  [[nodiscard]] T *column(const Chunk &chunk) const {
+    return reinterpret_cast<T *>(const_cast<std::byte *>(chunk.data) + offsets_[columns_[component_id<T>()]]);
+  }
+  [[nodiscard]] static const Entity *entities(const Chunk &chunk) {
+    return reinterpret_cast<const Entity *>(chunk.data);
+  }
+
+  // ---- Getters ----
+  [[nodiscard]] ComponentMask get_mask() const { return mask_; }
+  [[nodiscard]] std::uint32_t get_size() const { return size_; }
+  [[nodiscard]] std::uint32_t get_capacity() const { return capacity_; }
+  [[nodiscard]] const std::vector<std::unique_ptr<Chunk>> &get_chunks() const { return chunks_; }
+};
+
+// ---- World ----
+// Owns every entity and its components. Structural changes (create,
+// destroy, add, remove) must not overlap iteration; views themselves may
+// run concurrently as long as they write disjoint components.
+class World {
+private:
+  struct Record {
+    Archetype *archetype = nullptr;
+    std::uint32_t row = 0;
+    std::uint32_t generation = 0;
+  };
+
+  // ---- Variables ----
+  std::vector<Record> records_;
+  std::vector<std::uint32_t> free_indices_;
+  std::vector<std::unique_ptr<Archetype>> archetypes_;
+  std::unordered_map<ComponentMask, Archetype *> archetype_lookup_;
+  std::size_t alive_ = 0;
+
+  // ---- Private Methods ----
+  Archetype *get_archetype(ComponentMask mask, const std::vector<ComponentInfo> &components);
+  Entity allocate(Archetype *archetype);
+  void move_entity(Entity entity, Archetype *target);
+  void release_row(Archetype *archetype, std::uint32_t row);
+  [[nodiscard]] const Record *find(Entity entity) const;
+public:
+  // ---- Constructor & Destructor ----
+  World() = default;
+  ~World() = default;
+
+  World(const World&) = delete;
+  World& operator=(const World&) = delete;
+
+  // ---- Entities ----
+  template <Component... Ts>
+  Entity create(const Ts &... components);
+  void destroy(Entity entity);
+  [[nodiscard]] bool is_alive(Entity entity) const { return find(entity) != nullptr; }
+  void clear();
+
+  // ---- Components ----
+  // Adds or overwrites.
+  template <Component T>
+  void add(Entity entity, const T &component);
+  template <Component T>
+  void remove(Entity entity);
+  // nullptr if the entity is dead or lacks T. Invalidated by structural changes.
+  template <Component T>
+  [[nodiscard]] T *get(Entity entity) const;
+  template <Component T>
+  [[nodiscard]] bool has(Entity entity) const { return get<T>(entity) != nullptr; }
+
+  // ---- Views ----
+  // fn(count, entities, Ts*...) once per chunk holding all of Ts.
+  template <Component... Ts, typename Function>
+  void each_chunk(Function &&function) const;
+  // fn(Ts&...) once per entity holding all of Ts.
+  template <Component... Ts, typename Function>
+  void each(Function &&function) const;
+  // Like each(), with chunks spread across the job system.
+  template <Component... Ts, typename Function>
+  void parallel_each(Function &&function) const;
+
+  // ---- Getters ----
+  [[nodiscard]] std::size_t get_entity_count() const { return alive_; }
+  [[nodiscard]] std::size_t get_archetype_count() const { return archetypes_.size(); }
+};
+
+// ---- Template Definitions ----
+template <Component... Ts>
+Entity World::create(const Ts &... components) {
+  Archetype *archetype = get_archetype(component_mask<Ts...>(), {component_info<Ts>()...});
+  const Entity entity = allocate(archetype);
+  const std::uint32_t row = records_[entity.index].row;
+  (std::memcpy(archetype->component(row, component_id<Ts>()), &components, sizeof(Ts)), ...);
+  return entity;
+}
+
+template <Component T>
+void World::add(const Entity entity, const T &component) {
+  const Record *record = find(entity);
+  if (!record) throw std::runtime_error("World::add on a dead entity");
+
+  if (!record->archetype->has(component_id<T>())) {
+    auto components = record->archetype->get_components();
+    components.push_back(component_info<T>());
+    move_entity(entity, get_archetype(record->archetype->get_mask() | component_mask<T>(), components));
+    record = find(entity);
+  }
+  std::memcpy(record->archetype->component(record->row, component_id<T>()), &component, sizeof(T));
+}
+
+template <Component T>
+void World::remove(const Entity entity) {
+  const Record *record = find(entity);
+  if (!record || !record->archetype->has(component_id<T>())) return;
+
+  std::vector<ComponentInfo> components;
+  for (const auto &info : record->archetype->get_components()) {
+    if (info.id != component_id<T>()) components.push_back(info);
+  }
+  move_entity(entity, get_archetype(record->archetype->get_mask() & ~component_mask<T>(), components));
+}
+
+template <Component T>
+T *World::get(const Entity entity) const {
+  const Record *record = find(entity);
+  if (!record || !record->archetype->has(component_id<T>())) return nullptr;
+  return reinterpret_cast<T *>(record->archetype->component(record->row, component_id<T>()));
+}
+
+template <Component... Ts, typename Function>
+void World::each_chunk(Function &&function) const {
+  const ComponentMask required = component_mask<Ts...>();
+  for (const auto &archetype : archetypes_) {
+    if ((archetype->get_mask() & required) != required) continue;
+    for (const auto &chunk : archetype->get_chunks()) {
+      if (chunk->count == 0) continue;
+      function(static_cast<std::size_t>(chunk->count), Archetype::entities(*chunk), archetype->template column<Ts>(*chunk)...);
+    }
+  }
+}
+
+template <Component... Ts, typename Function>
+void World::each(Function &&function) const {
+  each_chunk<Ts...>([&](const std::size_t count, const Entity *, Ts *... columns) {
+    for (std::size_t i = 0; i < count; i++) function(columns[i]...);
+  });
+}
+
+template <Component... Ts, typename Function>
+void World::parallel_each(Function &&function) const {
+  // ---- One Job Per Chunk: Chunks Are Already Cache-Sized Batches ----
+  std::vector<std::pair<const Archetype *, const Archetype::Chunk *>> chunks;
+  const ComponentMask required = component_mask<Ts...>();
+  for (const auto &archetype : archetypes_) {
+    if ((archetype->get_mask() & required) != required) continue;
+    for (const auto &chunk : archetype->get_chunks()) {
+      if (chunk->count > 0) chunks.emplace_back(archetype.get(), chunk.get());
+    }
+  }
+
+  JobSystem::get_instance().parallel_for(chunks.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+    for (std::size_t c = begin; c < end; c++) {
+      const auto [archetype, chunk] = chunks[c];
+      const auto run = [&](Ts *... columns) {
+        for (std::uint32_t i = 0; i < chunk->count; i++) function(columns[i]...);
+      };
+      run(archetype->template column<Ts>(*chunk)...);
+    }
+  });
+}
+
+} // STARBORN
@@ -0,0 +1,14 @@
+#version 330 core
+layout(location = 0) in vec3 aPos;
+layout(location = 7) in vec4 aColor;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec4 vColor;
+
+void main() {
+    vColor = aColor;
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+}
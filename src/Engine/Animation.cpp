@@ -0,0 +1,167 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "Animation.hpp"
+#include "AnimationCompression.hpp"
+#include "PoseCache.hpp"
+#include "TransformHierarchy.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  namespace {
+    // ---- Keyframe Lookup: Index Of The Key At Or Before `time` ----
+    std::size_t find_key(const std::vector<float> &times, const float time) {
+      const auto it = std::upper_bound(times.begin(), times.end(), time);
+      return it == times.begin() ? 0 : static_cast<std::size_t>(it - times.begin()) - 1;
+    }
+
+    glm::quat nlerp(const glm::quat &from, glm::quat to, const float weight) {
+      if (dot(from, to) < 0.0f) to = -to;
+      return normalize(from * (1.0f - weight) + to * weight);
+    }
+
+    template <typename T, typename Interpolate>
+    void sample_channel(const AnimationClip::Channel<T> &channel, const float time, T &out,
+                        Interpolate &&interpolate) {
+      if (channel.values.empty()) return;
+      const std::size_t key = find_key(channel.times, time);
+      if (key + 1 >= channel.values.size()) {
+        out = channel.values[key];
+        return;
+      }
+
+      const float span = channel.times[key + 1] - channel.times[key];
+      const float weight = span > 0.0f ? std::clamp((time - channel.times[key]) / span, 0.0f, 1.0f) : 0.0f;
+      out = interpolate(channel.values[key], channel.values[key + 1], weight);
+    }
+
+    float wrap_time(const float time, const float duration, const bool looping) {
+      if (duration <= 0.0f) return 0.0f;
+      if (!looping) return std::clamp(time, 0.0f, duration);
+      const float wrapped = std::fmod(time, duration);
+      return wrapped < 0.0f ? wrapped + duration : wrapped;
+    }
+  }
+
+  // ---- Skeleton ----
+  std::uint32_t Skeleton::find_joint(const std::string_view name) const {
+    for (std::size_t joint = 0; joint < names.size(); joint++) {
+      if (names[joint] == name) return static_cast<std::uint32_t>(joint);
+    }
+    return NO_JOINT;
+  }
+
+  // ---- Pose Operations ----
+  void reset_pose(const Skeleton &skeleton, Pose &pose) {
+    pose.assign(skeleton.bind_pose.begin(), skeleton.bind_pose.end());
+  }
+
+  void sample(const AnimationClip &clip, const float time, Pose &pose) {
+    const auto lerp = [](const glm::vec3 &a, const glm::vec3 &b, const float t) { return mix(a, b, t); };
+    for (const auto &track : clip.tracks) {
+      Transform &local = pose[track.joint];
+      sample_channel(track.positions, time, local.position, lerp);
+      sample_channel(track.rotations, time, local.rotation, nlerp);
+      sample_channel(track.scales, time, local.scale, lerp);
+    }
+  }
+
+  void blend(const Pose &from, const Pose &to, const float weight, Pose &out) {
+    out.resize(from.size());
+    for (std::size_t joint = 0; joint < from.size(); joint++) {
+      out[joint].position = mix(from[joint].position, to[joint].position, weight);
+      out[joint].rotation = nlerp(from[joint].rotation, to[joint].rotation, weight);
+      out[joint].scale = mix(from[joint].scale, to[joint].scale, weight);
+    }
+  }
+
+  void compute_skinning(const Skeleton &skeleton, const Pose &pose,
+                        std::vector<glm::mat4> &joints, const std::span<glm::mat4> palette) {
+    // ---- Model Space: Parents Come First, So One Pass Suffices ----
+    joints.resize(pose.size());
+    for (std::size_t joint = 0; joint < pose.size(); joint++) {
+      const std::uint32_t parent = skeleton.parents[joint];
+      if (parent == Skeleton::NO_JOINT) joints[joint] = compose(pose[joint]);
+      else multiply(joints[parent], compose(pose[joint]), joints[joint]);
+    }
+
+    // ---- Palette: Bring Bind-Space Vertices Into The Posed Bone ----
+    const std::size_t count = std::min(palette.size(), skeleton.bone_joints.size());
+    for (std::size_t bone = 0; bone < count; bone++) {
+      multiply(joints[skeleton.bone_joints[bone]], skeleton.inverse_binds[bone], palette[bone]);
+    }
+  }
+
+  // ---- Animator ----
+  Animator::Animator(const Skeleton &skeleton) : skeleton_(&skeleton) {
+    reset_pose(skeleton, pose_);
+    next_pose_ = pose_;
+    joints_.resize(skeleton.get_joint_count());
+    palette_.resize(std::min(skeleton.get_bone_count(), MAX_JOINTS), glm::mat4(1.0f));
+  }
+
+  void Animator::play(const CompressedClip &clip, const float fade_seconds) {
+    if (!clip_ || fade_seconds <= 0.0f) {
+      clip_ = &clip;
+      next_clip_ = nullptr;
+      time_ = 0.0f;
+      return;
+    }
+    next_clip_ = &clip;
+    next_time_ = 0.0f;
+    fade_ = 0.0f;
+    fade_duration_ = fade_seconds;
+  }
+
+  void Animator::update(const float delta_time) {
+    if (!skeleton_) return;
+    if (!clip_) {
+      reset_pose(*skeleton_, pose_);
+      compute_skinning(*skeleton_, pose_, joints_, palette_);
+      return;
+    }
+
+    time_ += delta_time * speed_;
+    const float time = wrap_time(time_, clip_->duration, looping_);
+
+    // ---- Steady Playback Through The Cache: Someone Else May Have Skinned This Already ----
+    if (!next_clip_ && pose_cache_) {
+      const auto &cached = pose_cache_->evaluate(*skeleton_, *clip_, time);
+      std::copy(cached.pose.begin(), cached.pose.end(), pose_.begin());
+      std::copy(cached.palette.begin(), cached.palette.end(), palette_.begin());
+      return;
+    }
+
+    sample_pose(*clip_, time, pose_);
+
+    // ---- Cross-Fade: Sample The Incoming Clip And Blend Towards It ----
+    if (next_clip_) {
+      next_time_ += delta_time * speed_;
+      fade_ += delta_time;
+      sample_pose(*next_clip_, wrap_time(next_time_, next_clip_->duration, looping_), next_pose_);
+
+      const float weight = std::min(fade_ / fade_duration_, 1.0f);
+      blend(pose_, next_pose_, weight, pose_);
+      if (weight >= 1.0f) {
+        clip_ = next_clip_;
+        time_ = next_time_;
+        next_clip_ = nullptr;
+      }
+    }
+
+    compute_skinning(*skeleton_, pose_, joints_, palette_);
+  }
+
+  // ---- Private ----
+  void Animator::sample_pose(const CompressedClip &clip, const float time, Pose &pose) const {
+    if (pose_cache_) {
+      const auto &cached = pose_cache_->evaluate(*skeleton_, clip, time).pose;
+      std::copy(cached.begin(), cached.end(), pose.begin());
+      return;
+    }
+    std::copy(skeleton_->bind_pose.begin(), skeleton_->bind_pose.end(), pose.begin());
+    sample(clip, time, pose);
+  }
+} // STARBORN
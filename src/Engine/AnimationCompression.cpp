@@ -0,0 +1,219 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "AnimationCompression.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  namespace {
+    constexpr float QUANTIZED_MAX = 65535.0f;
+    // Smallest-three components lie in [-1/sqrt(2), 1/sqrt(2)] and get 15 bits each.
+    constexpr float SMALLEST_THREE_RANGE = 0.70710678f;
+    constexpr float SMALLEST_THREE_MAX = 32767.0f;
+
+    // ---- Error Metrics ----
+    float error(const glm::vec3 &a, const glm::vec3 &b) { return length(a - b); }
+
+    float error(const glm::quat &a, const glm::quat &b) {
+      return 2.0f * std::acos(std::min(1.0f, std::fabs(dot(a, b))));
+    }
+
+    glm::vec3 interpolate(const glm::vec3 &a, const glm::vec3 &b, const float weight) { return mix(a, b, weight); }
+
+    glm::quat interpolate(const glm::quat &a, glm::quat b, const float weight) {
+      if (dot(a, b) < 0.0f) b = -b;
+      return normalize(a * (1.0f - weight) + b * weight);
+    }
+
+    // ---- Key Reduction: Greedily Stretch Each Segment Until A Skipped Key Breaks Tolerance ----
+    template <typename T>
+    std::vector<std::size_t> reduce_keys(const AnimationClip::Channel<T> &channel, const float tolerance) {
+      std::vector<std::size_t> kept;
+      const std::size_t count = channel.values.size();
+      if (count == 0) return kept;
+      kept.push_back(0);
+
+      std::size_t anchor = 0;
+      for (std::size_t end = 2; end < count; end++) {
+        const float span = channel.times[end] - channel.times[anchor];
+        for (std::size_t skipped = anchor + 1; skipped < end; skipped++) {
+          const float weight = span > 0.0f ? (channel.times[skipped] - channel.times[anchor]) / span : 0.0f;
+          const T rebuilt = interpolate(channel.values[anchor], channel.values[end], weight);
+          if (error(rebuilt, channel.values[skipped]) > tolerance) {
+            anchor = end - 1;
+            kept.push_back(anchor);
+            break;
+          }
+        }
+      }
+
+      // ---- Constant Channels Collapse To One Key ----
+      if (count > 1) {
+        bool constant = true;
+        for (std::size_t key = 1; key < count && constant; key++) {
+          constant = error(channel.values[0], channel.values[key]) <= tolerance;
+        }
+        if (!constant && kept.back() != count - 1) kept.push_back(count - 1);
+      }
+      return kept;
+    }
+
+    std::uint16_t quantize_time(const float time, const float duration) {
+      if (duration <= 0.0f) return 0;
+      return static_cast<std::uint16_t>(std::lround(std::clamp(time / duration, 0.0f, 1.0f) * QUANTIZED_MAX));
+    }
+
+    // ---- Vectors: 16 Bits Per Axis Inside The Channel's Range ----
+    void encode_channel(const AnimationClip::Channel<glm::vec3> &channel, const float tolerance,
+                        const float duration, CompressedClip &clip, CompressedClip::Channel &out) {
+      const auto kept = reduce_keys(channel, tolerance);
+      out.first_key = static_cast<std::uint32_t>(clip.times.size());
+      out.key_count = static_cast<std::uint32_t>(kept.size());
+      if (kept.empty()) return;
+
+      glm::vec3 minimum = channel.values[kept.front()];
+      glm::vec3 maximum = minimum;
+      for (const std::size_t key : kept) {
+        minimum = min(minimum, channel.values[key]);
+        maximum = max(maximum, channel.values[key]);
+      }
+      out.minimum = minimum;
+      out.extent = (maximum - minimum) / QUANTIZED_MAX;
+
+      for (const std::size_t key : kept) {
+        std::array<std::uint16_t, 3> encoded{};
+        for (int axis = 0; axis < 3; axis++) {
+          const float normalized = out.extent[axis] > 0.0f
+                                     ? (channel.values[key][axis] - minimum[axis]) / out.extent[axis]
+                                     : 0.0f;
+          encoded[axis] = static_cast<std::uint16_t>(std::lround(std::clamp(normalized, 0.0f, QUANTIZED_MAX)));
+        }
+        clip.times.push_back(quantize_time(channel.times[key], duration));
+        clip.values.push_back(encoded);
+      }
+    }
+
+    // ---- Rotations: Drop The Largest Component, Its Index Rides In The Low Bits ----
+    std::array<std::uint16_t, 3> encode_rotation(const glm::quat &rotation) {
+      float components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+      int largest = 0;
+      for (int i = 1; i < 4; i++) {
+        if (std::fabs(components[i]) > std::fabs(components[largest])) largest = i;
+      }
+      const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+      std::array<std::uint16_t, 3> encoded{};
+      for (int i = 0, slot = 0; i < 4; i++) {
+        if (i == largest) continue;
+        const float normalized = (components[i] * sign / SMALLEST_THREE_RANGE + 1.0f) * 0.5f;
+        const auto bits = static_cast<std::uint16_t>(std::lround(std::clamp(normalized, 0.0f, 1.0f) * SMALLEST_THREE_MAX));
+        encoded[slot++] = static_cast<std::uint16_t>(bits << 1);
+      }
+      encoded[0] |= static_cast<std::uint16_t>(largest & 1);
+      encoded[1] |= static_cast<std::uint16_t>(largest >> 1);
+      return encoded;
+    }
+
+    glm::quat decode_rotation(const std::array<std::uint16_t, 3> &encoded) {
+      const int largest = (encoded[0] & 1) | ((encoded[1] & 1) << 1);
+      float components[4];
+      float sum = 0.0f;
+      for (int i = 0, slot = 0; i < 4; i++) {
+        if (i == largest) continue;
+        const float normalized = static_cast<float>(encoded[slot++] >> 1) / SMALLEST_THREE_MAX;
+        components[i] = (normalized * 2.0f - 1.0f) * SMALLEST_THREE_RANGE;
+        sum += components[i] * components[i];
+      }
+      components[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+      return {components[3], components[0], components[1], components[2]};
+    }
+
+    void encode_channel(const AnimationClip::Channel<glm::quat> &channel, const float tolerance,
+                        const float duration, CompressedClip &clip, CompressedClip::Channel &out) {
+      const auto kept = reduce_keys(channel, tolerance);
+      out.first_key = static_cast<std::uint32_t>(clip.times.size());
+      out.key_count = static_cast<std::uint32_t>(kept.size());
+      for (const std::size_t key : kept) {
+        clip.times.push_back(quantize_time(channel.times[key], duration));
+        clip.values.push_back(encode_rotation(normalize(channel.values[key])));
+      }
+    }
+
+    glm::vec3 decode_vector(const CompressedClip::Channel &channel, const std::array<std::uint16_t, 3> &encoded) {
+      return channel.minimum + glm::vec3(encoded[0], encoded[1], encoded[2]) * channel.extent;
+    }
+
+    // ---- Sampling: Binary Search The Channel's Slice Of The Time Array ----
+    template <typename T, typename Decode>
+    void sample_channel(const CompressedClip &clip, const CompressedClip::Channel &channel,
+                        const std::uint16_t time, T &out, Decode &&decode) {
+      if (channel.key_count == 0) return;
+      const auto first = clip.times.begin() + channel.first_key;
+      const auto last = first + channel.key_count;
+      const auto after = std::upper_bound(first, last, time);
+      const std::size_t key = channel.first_key + (after == first ? 0 : static_cast<std::size_t>(after - first) - 1);
+
+      if (after == last || after == first) {
+        out = decode(clip.values[key]);
+        return;
+      }
+      const float span = static_cast<float>(clip.times[key + 1] - clip.times[key]);
+      const float weight = span > 0.0f ? static_cast<float>(time - clip.times[key]) / span : 0.0f;
+      out = interpolate(decode(clip.values[key]), decode(clip.values[key + 1]), weight);
+    }
+  }
+
+  // ---- Sizes ----
+  std::size_t CompressedClip::get_byte_size() const {
+    return sizeof(CompressedClip) + tracks.size() * sizeof(Track) + times.size() * sizeof(std::uint16_t) +
+           values.size() * sizeof(values[0]) + name.size();
+  }
+
+  std::size_t get_byte_size(const AnimationClip &clip) {
+    std::size_t bytes = sizeof(AnimationClip) + clip.name.size();
+    for (const auto &track : clip.tracks) {
+      bytes += sizeof(track);
+      bytes += track.positions.times.size() * (sizeof(float) + sizeof(glm::vec3));
+      bytes += track.rotations.times.size() * (sizeof(float) + sizeof(glm::quat));
+      bytes += track.scales.times.size() * (sizeof(float) + sizeof(glm::vec3));
+    }
+    return bytes;
+  }
+
+  // ---- Compression ----
+  CompressedClip compress(const AnimationClip &clip, const CompressionSettings &settings) {
+    CompressedClip compressed;
+    compressed.name = clip.name;
+    compressed.duration = clip.duration;
+    compressed.tracks.reserve(clip.tracks.size());
+
+    for (const auto &track : clip.tracks) {
+      CompressedClip::Track out;
+      out.joint = track.joint;
+      encode_channel(track.positions, settings.position_tolerance, clip.duration, compressed, out.positions);
+      encode_channel(track.rotations, settings.rotation_tolerance, clip.duration, compressed, out.rotations);
+      encode_channel(track.scales, settings.scale_tolerance, clip.duration, compressed, out.scales);
+      compressed.tracks.push_back(out);
+    }
+
+    compressed.times.shrink_to_fit();
+    compressed.values.shrink_to_fit();
+    return compressed;
+  }
+
+  // ---- Sampling ----
+  void sample(const CompressedClip &clip, const float time, Pose &pose) {
+    const std::uint16_t quantized = quantize_time(time, clip.duration);
+    for (const auto &track : clip.tracks) {
+      Transform &local = pose[track.joint];
+      const auto vector = [&](const CompressedClip::Channel &channel) {
+        return [&](const std::array<std::uint16_t, 3> &encoded) { return decode_vector(channel, encoded); };
+      };
+      sample_channel(clip, track.positions, quantized, local.position, vector(track.positions));
+      sample_channel(clip, track.rotations, quantized, local.rotation, decode_rotation);
+      sample_channel(clip, track.scales, quantized, local.scale, vector(track.scales));
+    }
+  }
+} // STARBORN
@@ -0,0 +1,173 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "Broadphase.hpp"
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define STARBORN_BROADPHASE_SSE 1
+#endif
+
+namespace STARBORN {
+  namespace {
+    constexpr float EMPTY = std::numeric_limits<float>::infinity();
+  }
+
+  void Broadphase::Bounds::resize(const std::size_t size) {
+    min_x.resize(size);
+    min_y.resize(size);
+    min_z.resize(size);
+    max_x.resize(size);
+    max_y.resize(size);
+    max_z.resize(size);
+  }
+
+  // ---- Proxies ----
+  std::uint32_t Broadphase::create(const glm::vec3 &minimum, const glm::vec3 &maximum) {
+    std::uint32_t proxy;
+    if (!free_.empty()) {
+      proxy = free_.back();
+      free_.pop_back();
+    } else {
+      proxy = static_cast<std::uint32_t>(order_.size());
+      bounds_.resize(proxy + 1);
+      order_.push_back(proxy);
+    }
+    set_bounds(proxy, minimum, maximum);
+    alive_++;
+    return proxy;
+  }
+
+  void Broadphase::destroy(const std::uint32_t proxy) {
+    // ---- Inverted Infinite Box: Overlaps Nothing, Sorts Past Everything ----
+    set_bounds(proxy, glm::vec3(EMPTY), glm::vec3(-EMPTY));
+    free_.push_back(proxy);
+    alive_--;
+  }
+
+  void Broadphase::set_bounds(const std::uint32_t proxy, const glm::vec3 &minimum, const glm::vec3 &maximum) {
+    bounds_.min_x[proxy] = minimum.x;
+    bounds_.min_y[proxy] = minimum.y;
+    bounds_.min_z[proxy] = minimum.z;
+    bounds_.max_x[proxy] = maximum.x;
+    bounds_.max_y[proxy] = maximum.y;
+    bounds_.max_z[proxy] = maximum.z;
+  }
+
+  void Broadphase::clear() {
+    bounds_.resize(0);
+    sorted_.resize(0);
+    free_.clear();
+    order_.clear();
+    pairs_.clear();
+    sorted_count_ = 0;
+    alive_ = 0;
+  }
+
+  // ---- Update ----
+  void Broadphase::update() {
+    sort();
+    sweep();
+  }
+
+  void Broadphase::sort() {
+    const std::size_t count = order_.size();
+    sorted_.resize(count);
+
+    // ---- Bulk Spawns Land Unsorted At The End: Sort From Scratch ----
+    if (count - sorted_count_ > count / 8) {
+      std::sort(order_.begin(), order_.end(),
+                [this](const std::uint32_t a, const std::uint32_t b) { return bounds_.min_x[a] < bounds_.min_x[b]; });
+    }
+    sorted_count_ = count;
+
+    // ---- Insertion Sort Last Tick's Order: Cheap When Little Moved ----
+    for (std::size_t i = 0; i < count; i++) sorted_.min_x[i] = bounds_.min_x[order_[i]];
+    for (std::size_t i = 1; i < count; i++) {
+      const float key = sorted_.min_x[i];
+      const std::uint32_t proxy = order_[i];
+      std::size_t j = i;
+      while (j > 0 && sorted_.min_x[j - 1] > key) {
+        sorted_.min_x[j] = sorted_.min_x[j - 1];
+        order_[j] = order_[j - 1];
+        j--;
+      }
+      sorted_.min_x[j] = key;
+      order_[j] = proxy;
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+      const std::uint32_t proxy = order_[i];
+      sorted_.min_y[i] = bounds_.min_y[proxy];
+      sorted_.min_z[i] = bounds_.min_z[proxy];
+      sorted_.max_x[i] = bounds_.max_x[proxy];
+      sorted_.max_y[i] = bounds_.max_y[proxy];
+      sorted_.max_z[i] = bounds_.max_z[proxy];
+    }
+  }
+
+  void Broadphase::sweep() {
+    const std::size_t count = order_.size();
+    const std::size_t batches = (count + SWEEP_GRAIN - 1) / SWEEP_GRAIN;
+    if (batch_pairs_.size() < batches) batch_pairs_.resize(batches);
+
+    // ---- Each Box Scans Forward Until The Next Starts Past Its End ----
+    // parallel_for hands out grain-aligned ranges, so begin / grain names the batch.
+    JobSystem::get_instance().parallel_for(count, SWEEP_GRAIN, [&](const std::size_t begin, const std::size_t end) {
+      const float *min_x = sorted_.min_x.data(), *min_y = sorted_.min_y.data(), *min_z = sorted_.min_z.data();
+      const float *max_x = sorted_.max_x.data(), *max_y = sorted_.max_y.data(), *max_z = sorted_.max_z.data();
+      for (std::size_t batch = begin / SWEEP_GRAIN; batch * SWEEP_GRAIN < end; batch++) {
+        std::vector<Pair> &pairs = batch_pairs_[batch];
+        pairs.clear();
+        const std::size_t last = std::min(end, (batch + 1) * SWEEP_GRAIN);
+        for (std::size_t i = batch * SWEEP_GRAIN; i < last; i++) {
+          const float end_x = max_x[i];
+          const float low_y = min_y[i], high_y = max_y[i], low_z = min_z[i], high_z = max_z[i];
+          std::size_t j = i + 1;
+#ifdef STARBORN_BROADPHASE_SSE
+          // ---- Four Candidates At A Time; min_x Is Sorted, So Lanes Inside The Interval Form A Prefix ----
+          const __m128 end_x4 = _mm_set1_ps(end_x);
+          const __m128 low_y4 = _mm_set1_ps(low_y), high_y4 = _mm_set1_ps(high_y);
+          const __m128 low_z4 = _mm_set1_ps(low_z), high_z4 = _mm_set1_ps(high_z);
+          bool swept = false;
+          for (; j + 4 <= count; j += 4) {
+            const __m128 inside = _mm_cmple_ps(_mm_loadu_ps(min_x + j), end_x4);
+            const int inside_bits = _mm_movemask_ps(inside);
+            __m128 overlap = _mm_and_ps(inside, _mm_cmple_ps(_mm_loadu_ps(min_y + j), high_y4));
+            overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_loadu_ps(max_y + j), low_y4));
+            overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_loadu_ps(min_z + j), high_z4));
+            overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_loadu_ps(max_z + j), low_z4));
+            const int overlap_bits = _mm_movemask_ps(overlap);
+            for (int lane = 0; lane < 4; lane++) {
+              if (!(overlap_bits & (1 << lane))) continue;
+              const std::uint32_t a = order_[i], b = order_[j + lane];
+              pairs.push_back(a < b ? Pair{a, b} : Pair{b, a});
+            }
+            if (inside_bits != 0xf) {
+              swept = true;
+              break;
+            }
+          }
+          if (swept) continue;
+#endif
+          for (; j < count && min_x[j] <= end_x; j++) {
+            // ---- Non-Short-Circuit &: Overlaps Are Rare, So One Predictable Branch ----
+            const bool overlap = (min_y[j] <= high_y) & (max_y[j] >= low_y) & (min_z[j] <= high_z) & (max_z[j] >= low_z);
+            if (!overlap) continue;
+            const std::uint32_t a = order_[i], b = order_[j];
+            pairs.push_back(a < b ? Pair{a, b} : Pair{b, a});
+          }
+        }
+      }
+    });
+
+    pairs_.clear();
+    for (std::size_t batch = 0; batch < batches; batch++) {
+      pairs_.insert(pairs_.end(), batch_pairs_[batch].begin(), batch_pairs_[batch].end());
+    }
+  }
+} // STARBORN
@@ -3,26 +3,171 @@
 */
 
 #include "Camera.hpp"
+#include <cmath>
 
 namespace STARBORN {
   // ---- Constructor ----
    Camera::Camera(const glm::vec3 &position, const glm::vec3 &target, float fov,
                float aspect_ratio, float near_plane, float far_plane)
-                 : position_(position), target_(target) {
-     direction_ = normalize(position - target);
-     up_ = glm::vec3(0.0f, 1.0f, 0.0f);
-     right_ = normalize(cross(up_, direction_));
-     camera_up_ = normalize(cross(direction_, right_));
-     projection_ = glm::perspective(fov, aspect_ratio, near_plane, far_plane);
+                 : position_(position), direction_(normalize(target - position)), fov_(fov),
+                   aspect_ratio_(aspect_ratio), near_plane_(near_plane), far_plane_(far_plane) {
+     update_basis();
   }
 
-  // ---- Getters ----
-  glm::mat4 Camera::get_view_matrix() const {
-     return glm::lookAt(position_, target_, up_);
+  // ---- Cache ----
+  void Camera::update_basis() {
+     // ---- Derived Once Here So It Can't Drift From direction_ ----
+     right_ = normalize(cross(direction_, up_));
+     camera_up_ = cross(right_, direction_);
+     view_dirty_ = true;
   }
 
-  glm::mat4 Camera::get_projection_matrix() const {
+  void Camera::update_view() const {
+     view_ = glm::lookAt(position_, position_ + direction_, up_);
+     inverse_view_ = inverse(view_);
+     view_dirty_ = false;
+     derived_dirty_ = true;
+  }
+
+  void Camera::update_projection() const {
+     if (projection_mode_ == Projection::REVERSE_Z_INFINITE) {
+       // ---- clip.z = near, clip.w = -view.z, So Depth = near / distance ----
+       const float focal_length = 1.0f / std::tan(glm::radians(fov_) * 0.5f);
+       projection_ = glm::mat4(0.0f);
+       projection_[0][0] = focal_length / aspect_ratio_;
+       projection_[1][1] = focal_length;
+       projection_[2][3] = -1.0f;
+       projection_[3][2] = near_plane_;
+     } else {
+       projection_ = glm::perspective(glm::radians(fov_), aspect_ratio_, near_plane_, far_plane_);
+     }
+     inverse_projection_ = inverse(projection_);
+     projection_dirty_ = false;
+     derived_dirty_ = true;
+  }
+
+  void Camera::update_derived() const {
+     if (view_dirty_) update_view();
+     if (projection_dirty_) update_projection();
+     if (!derived_dirty_) return;
+
+     view_projection_ = projection_ * view_;
+     inverse_view_projection_ = inverse(view_projection_);
+
+     // ---- Gribb-Hartmann: Planes Are Sums/Differences Of The Rows ----
+     const glm::mat4 rows = transpose(view_projection_);
+     frustum_[PLANE_LEFT] = rows[3] + rows[0];
+     frustum_[PLANE_RIGHT] = rows[3] - rows[0];
+     frustum_[PLANE_BOTTOM] = rows[3] + rows[1];
+     frustum_[PLANE_TOP] = rows[3] - rows[1];
+     if (projection_mode_ == Projection::REVERSE_Z_INFINITE) {
+       // ---- 0..1 Depth, Reversed: Near Is z <= w; The Far Plane Is At Infinity ----
+       frustum_[PLANE_NEAR] = rows[3] - rows[2];
+       frustum_[PLANE_FAR] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+     } else {
+       frustum_[PLANE_NEAR] = rows[3] + rows[2];
+       frustum_[PLANE_FAR] = rows[3] - rows[2];
+     }
+     for (auto &plane : frustum_) {
+       const float normal_length = length(glm::vec3(plane));
+       if (normal_length > 0.0f) plane /= normal_length;
+     }
+
+     derived_dirty_ = false;
+  }
+
+  // ---- Setters ----
+  void Camera::set_position(const glm::vec3 &position) {
+     position_ = position;
+     view_dirty_ = true;
+  }
+
+  void Camera::set_direction(const glm::vec3 &direction) {
+     direction_ = normalize(direction);
+     update_basis();
+  }
+
+  void Camera::set_target(const glm::vec3 &target) {
+     set_direction(target - position_);
+  }
+
+  void Camera::set_view(const glm::vec3 &position, const glm::vec3 &direction) {
+     position_ = position;
+     set_direction(direction);
+  }
+
+  void Camera::set_fov(const float fov) {
+     if (fov == fov_) return;
+     fov_ = fov;
+     projection_dirty_ = true;
+  }
+
+  void Camera::set_aspect_ratio(const float aspect_ratio) {
+     if (aspect_ratio == aspect_ratio_) return;
+     aspect_ratio_ = aspect_ratio;
+     projection_dirty_ = true;
+  }
+
+  void Camera::set_near_plane(const float near_plane) {
+     if (near_plane == near_plane_) return;
+     near_plane_ = near_plane;
+     projection_dirty_ = true;
+  }
+
+  void Camera::set_far_plane(const float far_plane) {
+     if (far_plane == far_plane_) return;
+     far_plane_ = far_plane;
+     projection_dirty_ = true;
+  }
+
+  void Camera::set_projection_mode(const Projection projection_mode) {
+     if (projection_mode == projection_mode_) return;
+     projection_mode_ = projection_mode;
+     projection_dirty_ = true;
+  }
+
+  // ---- Matrices ----
+  const glm::mat4 &Camera::get_view_matrix() const {
+     if (view_dirty_) update_view();
+     return view_;
+  }
+
+  const glm::mat4 &Camera::get_projection_matrix() const {
+     if (projection_dirty_) update_projection();
      return projection_;
   }
 
-} // STARBORN
\ No newline at end of file
+  const glm::mat4 &Camera::get_view_projection_matrix() const {
+     update_derived();
+     return view_projection_;
+  }
+
+  const glm::mat4 &Camera::get_inverse_view_matrix() const {
+     if (view_dirty_) update_view();
+     return inverse_view_;
+  }
+
+  const glm::mat4 &Camera::get_inverse_projection_matrix() const {
+     if (projection_dirty_) update_projection();
+     return inverse_projection_;
+  }
+
+  const glm::mat4 &Camera::get_inverse_view_projection_matrix() const {
+     update_derived();
+     return inverse_view_projection_;
+  }
+
+  // ---- Frustum ----
+  const Camera::Frustum &Camera::get_frustum_planes() const {
+     update_derived();
+     return frustum_;
+  }
+
+  bool Camera::is_sphere_visible(const glm::vec3 &center, const float radius) const {
+     for (const auto &plane : get_frustum_planes()) {
+       if (dot(glm::vec3(plane), center) + plane.w < -radius) return false;
+     }
+     return true;
+  }
+
+} // STARBORN
@@ -0,0 +1,662 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "CollisionMesh.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define STARBORN_COLLISION_SSE 1
+#endif
+
+namespace STARBORN {
+  struct CollisionMesh::BuildTriangle {
+    glm::vec3 v0, v1, v2;
+    glm::vec3 minimum, maximum, centroid;
+    std::uint32_t id;
+  };
+
+  namespace {
+    constexpr std::uint32_t CACHE_MAGIC = 0x56424f53; // "SOBV"
+    constexpr std::uint32_t CACHE_VERSION = 1;
+    constexpr int SAH_BINS = 16;
+    // Past this depth splits fall back to the median, which bounds the traversal stack.
+    constexpr int MAX_SAH_DEPTH = 48;
+    constexpr int STACK_SIZE = 128;
+    constexpr float CONTACT_TOLERANCE = 1e-4f;
+    constexpr int MAX_ADVANCE_STEPS = 32;
+
+    struct CacheHeader {
+      std::uint32_t magic;
+      std::uint32_t version;
+      std::uint64_t key;
+      std::uint64_t node_count;
+      std::uint64_t pack_count;
+      std::uint64_t triangle_count;
+    };
+
+    // ---- FNV-1a ----
+    std::uint64_t hash_bytes(std::uint64_t hash, const void *data, const std::size_t size) {
+      const auto *bytes = static_cast<const unsigned char *>(data);
+      for (std::size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+      }
+      return hash;
+    }
+
+    float half_area(const glm::vec3 &minimum, const glm::vec3 &maximum) {
+      const glm::vec3 extent = maximum - minimum;
+      return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+
+    // ---- Closest Points (Ericson, Real-Time Collision Detection 5.1) ----
+    glm::vec3 closest_point_triangle(const glm::vec3 &p, const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c) {
+      const glm::vec3 ab = b - a, ac = c - a, ap = p - a;
+      const float d1 = dot(ab, ap), d2 = dot(ac, ap);
+      if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+      const glm::vec3 bp = p - b;
+      const float d3 = dot(ab, bp), d4 = dot(ac, bp);
+      if (d3 >= 0.0f && d4 <= d3) return b;
+
+      const float vc = d1 * d4 - d3 * d2;
+      if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+      const glm::vec3 cp = p - c;
+      const float d5 = dot(ab, cp), d6 = dot(ac, cp);
+      if (d6 >= 0.0f && d5 <= d6) return c;
+
+      const float vb = d5 * d2 - d1 * d6;
+      if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+      const float va = d3 * d6 - d5 * d4;
+      if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+      const float denominator = 1.0f / (va + vb + vc);
+      return a + ab * (vb * denominator) + ac * (vc * denominator);
+    }
+
+    float closest_segment_segment(const glm::vec3 &p1, const glm::vec3 &q1, const glm::vec3 &p2, const glm::vec3 &q2,
+                                  glm::vec3 &c1, glm::vec3 &c2) {
+      const glm::vec3 d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+      const float a = dot(d1, d1), e = dot(d2, d2), f = dot(d2, r);
+      float s, t;
+
+      if (a <= 1e-12f && e <= 1e-12f) {
+        s = t = 0.0f;
+      } else if (a <= 1e-12f) {
+        s = 0.0f;
+        t = std::clamp(f / e, 0.0f, 1.0f);
+      } else {
+        const float c = dot(d1, r);
+        if (e <= 1e-12f) {
+          t = 0.0f;
+          s = std::clamp(-c / a, 0.0f, 1.0f);
+        } else {
+          const float b = dot(d1, d2);
+          const float denominator = a * e - b * b;
+          s = denominator != 0.0f ? std::clamp((b * f - c * e) / denominator, 0.0f, 1.0f) : 0.0f;
+          t = (b * s + f) / e;
+          if (t < 0.0f) {
+            t = 0.0f;
+            s = std::clamp(-c / a, 0.0f, 1.0f);
+          } else if (t > 1.0f) {
+            t = 1.0f;
+            s = std::clamp((b - c) / a, 0.0f, 1.0f);
+          }
+        }
+      }
+
+      c1 = p1 + d1 * s;
+      c2 = p2 + d2 * t;
+      const glm::vec3 delta = c1 - c2;
+      return dot(delta, delta);
+    }
+
+    bool segment_hits_triangle(const glm::vec3 &p, const glm::vec3 &q, const glm::vec3 &a, const glm::vec3 &b,
+                               const glm::vec3 &c, glm::vec3 &point) {
+      const glm::vec3 direction = q - p, e1 = b - a, e2 = c - a;
+      const glm::vec3 pvec = cross(direction, e2);
+      const float det = dot(e1, pvec);
+      if (std::fabs(det) < 1e-12f) return false;
+
+      const float inverse = 1.0f / det;
+      const glm::vec3 tvec = p - a;
+      const float u = dot(tvec, pvec) * inverse;
+      if (u < 0.0f || u > 1.0f) return false;
+      const glm::vec3 qvec = cross(tvec, e1);
+      const float v = dot(direction, qvec) * inverse;
+      if (v < 0.0f || u + v > 1.0f) return false;
+      const float t = dot(e2, qvec) * inverse;
+      if (t < 0.0f || t > 1.0f) return false;
+
+      point = p + direction * t;
+      return true;
+    }
+
+    // Squared distance between segment p-q and triangle a-b-c, with the closest points.
+    float closest_segment_triangle(const glm::vec3 &p, const glm::vec3 &q, const glm::vec3 &a, const glm::vec3 &b,
+                                   const glm::vec3 &c, glm::vec3 &on_segment, glm::vec3 &on_triangle) {
+      if (segment_hits_triangle(p, q, a, b, c, on_segment)) {
+        on_triangle = on_segment;
+        return 0.0f;
+      }
+
+      float best = std::numeric_limits<float>::max();
+      const auto consider = [&](const glm::vec3 &s, const glm::vec3 &t) {
+        const glm::vec3 delta = s - t;
+        const float distance = dot(delta, delta);
+        if (distance < best) {
+          best = distance;
+          on_segment = s;
+          on_triangle = t;
+        }
+      };
+
+      consider(p, closest_point_triangle(p, a, b, c));
+      consider(q, closest_point_triangle(q, a, b, c));
+
+      const std::array<std::array<glm::vec3, 2>, 3> edges{{{a, b}, {b, c}, {c, a}}};
+      for (const auto &edge : edges) {
+        glm::vec3 s, t;
+        closest_segment_segment(p, q, edge[0], edge[1], s, t);
+        consider(s, t);
+      }
+      return best;
+    }
+
+    // ---- Conservative Advancement: The Distance Is Convex In t, So Each Step Undershoots ----
+    bool sweep_triangle(const Capsule &capsule, const glm::vec3 &motion, const glm::vec3 &a, const glm::vec3 &b,
+                        const glm::vec3 &c, SweepHit &hit) {
+      float t = 0.0f;
+      glm::vec3 last_normal(0.0f), last_point(0.0f);
+      for (int step = 0; step < MAX_ADVANCE_STEPS; step++) {
+        glm::vec3 on_segment, on_triangle;
+        const float distance = std::sqrt(closest_segment_triangle(capsule.a + motion * t, capsule.b + motion * t,
+                                                                  a, b, c, on_segment, on_triangle));
+        const glm::vec3 towards = on_triangle - on_segment;
+
+        if (distance <= capsule.radius + CONTACT_TOLERANCE) {
+          // ---- Resting Contact We're Moving Away From Or Along Isn't A Hit ----
+          if (step == 0 && distance >= capsule.radius && dot(motion, towards) <= 0.0f) return false;
+
+          glm::vec3 normal = -towards / distance;
+          if (distance <= 1e-6f) {
+            normal = normalize(cross(b - a, c - a));
+            if (dot(normal, motion) > 0.0f) normal = -normal;
+          }
+          hit.fraction = t;
+          hit.normal = normal;
+          hit.point = on_triangle;
+          hit.depth = step == 0 ? std::max(0.0f, capsule.radius - distance) : 0.0f;
+          return true;
+        }
+
+        const float closing_speed = dot(motion, towards) / distance;
+        if (closing_speed <= 1e-9f) return false;
+        t += (distance - capsule.radius) / closing_speed;
+        if (t > 1.0f) return false;
+        last_normal = -towards / distance;
+        last_point = on_triangle;
+      }
+
+      // ---- Still Closing In When Steps Run Out (Grazing Approach): Stop Here ----
+      hit.fraction = t;
+      hit.normal = last_normal;
+      hit.point = last_point;
+      hit.depth = 0.0f;
+      return true;
+    }
+
+    // ---- Ray Setup: No Zero Components, So Slabs Never See 0 * inf ----
+    glm::vec3 safe_inverse(const glm::vec3 &direction) {
+      glm::vec3 inverse;
+      for (int axis = 0; axis < 3; axis++) {
+        const float component = std::fabs(direction[axis]) < 1e-12f ? std::copysign(1e-12f, direction[axis])
+                                                                    : direction[axis];
+        inverse[axis] = 1.0f / component;
+      }
+      return inverse;
+    }
+
+    // Entry distance if the ray meets the box before `limit`.
+    bool ray_box(const CollisionMesh::Node &node, const glm::vec3 &origin, const glm::vec3 &inverse,
+                 const float limit, float &entry) {
+#ifdef STARBORN_COLLISION_SSE
+      // ---- Lane 3 Carries index/count Bits; Zeroed Origin And Inverse Neutralise It, Masks Finish The Job ----
+      const __m128 xyz_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+      const __m128 o = _mm_set_ps(0.0f, origin.z, origin.y, origin.x);
+      const __m128 inv = _mm_set_ps(0.0f, inverse.z, inverse.y, inverse.x);
+      const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node.minimum.x), o), inv);
+      const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node.maximum.x), o), inv);
+
+      __m128 near = _mm_and_ps(_mm_min_ps(t1, t2), xyz_mask);
+      __m128 far = _mm_or_ps(_mm_and_ps(_mm_max_ps(t1, t2), xyz_mask), _mm_andnot_ps(xyz_mask, _mm_set1_ps(limit)));
+      near = _mm_max_ps(near, _mm_shuffle_ps(near, near, _MM_SHUFFLE(2, 3, 0, 1)));
+      near = _mm_max_ps(near, _mm_shuffle_ps(near, near, _MM_SHUFFLE(1, 0, 3, 2)));
+      far = _mm_min_ps(far, _mm_shuffle_ps(far, far, _MM_SHUFFLE(2, 3, 0, 1)));
+      far = _mm_min_ps(far, _mm_shuffle_ps(far, far, _MM_SHUFFLE(1, 0, 3, 2)));
+
+      entry = _mm_cvtss_f32(near);
+      return entry <= _mm_cvtss_f32(far);
+#else
+      float near = 0.0f, far = limit;
+      for (int axis = 0; axis < 3; axis++) {
+        const float t1 = (node.minimum[axis] - origin[axis]) * inverse[axis];
+        const float t2 = (node.maximum[axis] - origin[axis]) * inverse[axis];
+        near = std::max(near, std::min(t1, t2));
+        far = std::min(far, std::max(t1, t2));
+      }
+      entry = near;
+      return near <= far;
+#endif
+    }
+
+    // ---- Möller-Trumbore On Four Triangles At Once; Returns The Lane Hit, Or -1 ----
+    int ray_pack(const CollisionMesh::TrianglePack &pack, const glm::vec3 &origin, const glm::vec3 &direction,
+                 float &best) {
+#ifdef STARBORN_COLLISION_SSE
+      const __m128 dx = _mm_set1_ps(direction.x), dy = _mm_set1_ps(direction.y), dz = _mm_set1_ps(direction.z);
+      const __m128 e1x = _mm_load_ps(pack.e1[0]), e1y = _mm_load_ps(pack.e1[1]), e1z = _mm_load_ps(pack.e1[2]);
+      const __m128 e2x = _mm_load_ps(pack.e2[0]), e2y = _mm_load_ps(pack.e2[1]), e2z = _mm_load_ps(pack.e2[2]);
+
+      const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+      const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+      const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+      const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+      const __m128 inverse = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+      const __m128 tx = _mm_sub_ps(_mm_set1_ps(origin.x), _mm_load_ps(pack.v0[0]));
+      const __m128 ty = _mm_sub_ps(_mm_set1_ps(origin.y), _mm_load_ps(pack.v0[1]));
+      const __m128 tz = _mm_sub_ps(_mm_set1_ps(origin.z), _mm_load_ps(pack.v0[2]));
+      const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), inverse);
+
+      const __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+      const __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+      const __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+      const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverse);
+      const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverse);
+
+      // ---- NaN From Degenerate Lanes Fails Every Comparison ----
+      const __m128 zero = _mm_setzero_ps();
+      const __m128 abs_det = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+      __m128 mask = _mm_cmpgt_ps(abs_det, _mm_set1_ps(1e-12f));
+      mask = _mm_and_ps(mask, _mm_cmpge_ps(u, zero));
+      mask = _mm_and_ps(mask, _mm_cmpge_ps(v, zero));
+      mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+      mask = _mm_and_ps(mask, _mm_cmpgt_ps(t, zero));
+      mask = _mm_and_ps(mask, _mm_cmplt_ps(t, _mm_set1_ps(best)));
+
+      const int bits = _mm_movemask_ps(mask);
+      if (bits == 0) return -1;
+
+      alignas(16) float distances[4];
+      _mm_store_ps(distances, t);
+      int lane = -1;
+      for (int candidate = 0; candidate < 4; candidate++) {
+        if ((bits & (1 << candidate)) && distances[candidate] < best) {
+          best = distances[candidate];
+          lane = candidate;
+        }
+      }
+      return lane;
+#else
+      int lane = -1;
+      for (std::uint32_t i = 0; i < CollisionMesh::LEAF_SIZE; i++) {
+        const glm::vec3 e1(pack.e1[0][i], pack.e1[1][i], pack.e1[2][i]);
+        const glm::vec3 e2(pack.e2[0][i], pack.e2[1][i], pack.e2[2][i]);
+        const glm::vec3 pvec = cross(direction, e2);
+        const float det = dot(e1, pvec);
+        if (std::fabs(det) <= 1e-12f) continue;
+        const float inverse = 1.0f / det;
+        const glm::vec3 tvec = origin - glm::vec3(pack.v0[0][i], pack.v0[1][i], pack.v0[2][i]);
+        const float u = dot(tvec, pvec) * inverse;
+        const glm::vec3 qvec = cross(tvec, e1);
+        const float v = dot(direction, qvec) * inverse;
+        const float t = dot(e2, qvec) * inverse;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < best) {
+          best = t;
+          lane = static_cast<int>(i);
+        }
+      }
+      return lane;
+#endif
+    }
+  }
+
+  // ---- Build ----
+  void CollisionMesh::build(const std::span<const glm::vec3> positions, const std::span<const std::uint32_t> indices) {
+    clear();
+
+    std::vector<BuildTriangle> triangles;
+    triangles.reserve(indices.size() / 3);
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+      const glm::vec3 &v0 = positions[indices[i]], &v1 = positions[indices[i + 1]], &v2 = positions[indices[i + 2]];
+      if (dot(cross(v1 - v0, v2 - v0), cross(v1 - v0, v2 - v0)) <= 0.0f) continue;
+
+      BuildTriangle triangle{v0, v1, v2, min(v0, min(v1, v2)), max(v0, max(v1, v2)), (v0 + v1 + v2) / 3.0f,
+                             static_cast<std::uint32_t>(i / 3)};
+      triangles.push_back(triangle);
+    }
+    if (triangles.empty()) return;
+
+    triangle_count_ = triangles.size();
+    nodes_.reserve(triangles.size() / 2 + 1);
+    packs_.reserve(triangles.size() / 2 + 1);
+    nodes_.emplace_back();
+    build_node(0, triangles, 0, triangles.size());
+  }
+
+  void CollisionMesh::build_node(const std::uint32_t node, std::vector<BuildTriangle> &triangles,
+                                 const std::size_t begin, const std::size_t end) {
+    // ---- Depth Without A Stored Field: Count Parents Via The Recursion ----
+    thread_local int depth = 0;
+
+    glm::vec3 minimum(std::numeric_limits<float>::max()), maximum(-std::numeric_limits<float>::max());
+    glm::vec3 centroid_min = minimum, centroid_max = maximum;
+    for (std::size_t i = begin; i < end; i++) {
+      minimum = min(minimum, triangles[i].minimum);
+      maximum = max(maximum, triangles[i].maximum);
+      centroid_min = min(centroid_min, triangles[i].centroid);
+      centroid_max = max(centroid_max, triangles[i].centroid);
+    }
+    nodes_[node].minimum = minimum;
+    nodes_[node].maximum = maximum;
+
+    const std::size_t count = end - begin;
+    if (count <= LEAF_SIZE) {
+      make_leaf(nodes_[node], triangles, begin, end);
+      return;
+    }
+
+    // ---- Binned SAH Over Centroids On All Three Axes ----
+    int best_axis = -1;
+    int best_split = 0;
+    float best_cost = std::numeric_limits<float>::max();
+    if (depth < MAX_SAH_DEPTH) {
+      for (int axis = 0; axis < 3; axis++) {
+        const float extent = centroid_max[axis] - centroid_min[axis];
+        if (extent <= 0.0f) continue;
+
+        struct Bin {
+          glm::vec3 minimum{std::numeric_limits<float>::max()};
+          glm::vec3 maximum{-std::numeric_limits<float>::max()};
+          std::size_t count = 0;
+        };
+        std::array<Bin, SAH_BINS> bins{};
+        const float scale = SAH_BINS / extent;
+        for (std::size_t i = begin; i < end; i++) {
+          const int index = std::min(SAH_BINS - 1, static_cast<int>((triangles[i].centroid[axis] - centroid_min[axis]) * scale));
+          bins[index].minimum = min(bins[index].minimum, triangles[i].minimum);
+          bins[index].maximum = max(bins[index].maximum, triangles[i].maximum);
+          bins[index].count++;
+        }
+
+        // ---- Sweep Right-To-Left For Suffix Areas, Then Left-To-Right ----
+        std::array<float, SAH_BINS> right_cost{};
+        Bin right;
+        for (int split = SAH_BINS - 1; split > 0; split--) {
+          right.minimum = min(right.minimum, bins[split].minimum);
+          right.maximum = max(right.maximum, bins[split].maximum);
+          right.count += bins[split].count;
+          right_cost[split] = right.count ? half_area(right.minimum, right.maximum) * static_cast<float>(right.count) : 0.0f;
+        }
+        Bin left;
+        for (int split = 1; split < SAH_BINS; split++) {
+          left.minimum = min(left.minimum, bins[split - 1].minimum);
+          left.maximum = max(left.maximum, bins[split - 1].maximum);
+          left.count += bins[split - 1].count;
+          if (left.count == 0 || left.count == count) continue;
+          const float cost = half_area(left.minimum, left.maximum) * static_cast<float>(left.count) + right_cost[split];
+          if (cost < best_cost) {
+            best_cost = cost;
+            best_axis = axis;
+            best_split = split;
+          }
+        }
+      }
+    }
+
+    // ---- Partition, Or Median Split When SAH Found Nothing Useful ----
+    std::size_t middle = begin;
+    if (best_axis >= 0) {
+      const float scale = SAH_BINS / (centroid_max[best_axis] - centroid_min[best_axis]);
+      middle = static_cast<std::size_t>(std::partition(triangles.begin() + static_cast<std::ptrdiff_t>(begin),
+                                                       triangles.begin() + static_cast<std::ptrdiff_t>(end),
+                                                       [&](const BuildTriangle &triangle) {
+        const int index = std::min(SAH_BINS - 1, static_cast<int>((triangle.centroid[best_axis] - centroid_min[best_axis]) * scale));
+        return index < best_split;
+      }) - triangles.begin());
+    }
+    if (middle == begin || middle == end) {
+      const glm::vec3 extent = centroid_max - centroid_min;
+      const int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+      middle = begin + count / 2;
+      std::nth_element(triangles.begin() + static_cast<std::ptrdiff_t>(begin),
+                       triangles.begin() + static_cast<std::ptrdiff_t>(middle),
+                       triangles.begin() + static_cast<std::ptrdiff_t>(end),
+                       [axis](const BuildTriangle &a, const BuildTriangle &b) { return a.centroid[axis] < b.centroid[axis]; });
+    }
+
+    // ---- Children Are Adjacent; Don't Hold References Across The Push ----
+    const auto left = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_.emplace_back();
+    nodes_[node].index = left;
+    nodes_[node].count = 0;
+
+    depth++;
+    build_node(left, triangles, begin, middle);
+    build_node(left + 1, triangles, middle, end);
+    depth--;
+  }
+
+  void CollisionMesh::make_leaf(Node &node, const std::vector<BuildTriangle> &triangles,
+                                const std::size_t begin, const std::size_t end) {
+    TrianglePack pack{};
+    std::fill(std::begin(pack.ids), std::end(pack.ids), NO_TRIANGLE);
+    for (std::size_t i = begin; i < end; i++) {
+      const std::size_t lane = i - begin;
+      const BuildTriangle &triangle = triangles[i];
+      const glm::vec3 e1 = triangle.v1 - triangle.v0, e2 = triangle.v2 - triangle.v0;
+      for (int axis = 0; axis < 3; axis++) {
+        pack.v0[axis][lane] = triangle.v0[axis];
+        pack.e1[axis][lane] = e1[axis];
+        pack.e2[axis][lane] = e2[axis];
+      }
+      pack.ids[lane] = triangle.id;
+    }
+
+    node.index = static_cast<std::uint32_t>(packs_.size());
+    node.count = static_cast<std::uint32_t>(end - begin);
+    packs_.push_back(pack);
+  }
+
+  void CollisionMesh::build_cached(const std::span<const glm::vec3> positions,
+                                   const std::span<const std::uint32_t> indices,
+                                   const std::filesystem::path &directory) {
+    const std::uint64_t key = make_key(positions, indices);
+    std::stringstream name;
+    name << std::hex << key << ".bvh";
+    const auto path = directory / name.str();
+
+    if (load(path, key)) return;
+    build(positions, indices);
+    save(path, key);
+  }
+
+  void CollisionMesh::clear() {
+    nodes_.clear();
+    packs_.clear();
+    triangle_count_ = 0;
+  }
+
+  // ---- Cache ----
+  std::uint64_t CollisionMesh::make_key(const std::span<const glm::vec3> positions,
+                                        const std::span<const std::uint32_t> indices) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hash_bytes(hash, &CACHE_VERSION, sizeof(CACHE_VERSION));
+    hash = hash_bytes(hash, positions.data(), positions.size_bytes());
+    hash = hash_bytes(hash, indices.data(), indices.size_bytes());
+    return hash;
+  }
+
+  bool CollisionMesh::load(const std::filesystem::path &path, const std::uint64_t key) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    CacheHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.key != key) return false;
+
+    nodes_.resize(header.node_count);
+    packs_.resize(header.pack_count);
+    file.read(reinterpret_cast<char *>(nodes_.data()), static_cast<std::streamsize>(nodes_.size() * sizeof(Node)));
+    file.read(reinterpret_cast<char *>(packs_.data()), static_cast<std::streamsize>(packs_.size() * sizeof(TrianglePack)));
+
+    // ---- Truncated Entry: Rebuild Instead ----
+    if (!file) {
+      clear();
+      return false;
+    }
+    triangle_count_ = header.triangle_count;
+    return true;
+  }
+
+  void CollisionMesh::save(const std::filesystem::path &path, const std::uint64_t key) const {
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      std::cerr << "ERROR::COLLISION_MESH::CACHE_WRITE_FAILED " << path << std::endl;
+      return;
+    }
+    const CacheHeader header{CACHE_MAGIC, CACHE_VERSION, key, nodes_.size(), packs_.size(), triangle_count_};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(nodes_.data()), static_cast<std::streamsize>(nodes_.size() * sizeof(Node)));
+    file.write(reinterpret_cast<const char *>(packs_.data()), static_cast<std::streamsize>(packs_.size() * sizeof(TrianglePack)));
+  }
+
+  // ---- Queries ----
+  void CollisionMesh::query(const glm::vec3 &minimum, const glm::vec3 &maximum, std::vector<std::uint32_t> &packs) const {
+    std::array<std::uint32_t, STACK_SIZE> stack{};
+    int size = 0;
+    stack[size++] = 0;
+
+    while (size > 0) {
+      const Node &node = nodes_[stack[--size]];
+      if (node.minimum.x > maximum.x || node.maximum.x < minimum.x ||
+          node.minimum.y > maximum.y || node.maximum.y < minimum.y ||
+          node.minimum.z > maximum.z || node.maximum.z < minimum.z) continue;
+
+      if (node.count > 0) {
+        packs.push_back(node.index);
+      } else {
+        stack[size++] = node.index + 1;
+        stack[size++] = node.index;
+      }
+    }
+  }
+
+  bool CollisionMesh::raycast(const Ray &ray, RayHit &hit) const {
+    if (nodes_.empty()) return false;
+
+    const glm::vec3 inverse = safe_inverse(ray.direction);
+    float best = ray.max_distance;
+    std::uint32_t best_pack = 0;
+    int best_lane = -1;
+
+    struct Entry {
+      std::uint32_t node;
+      float entry;
+    };
+    std::array<Entry, STACK_SIZE> stack{};
+    int size = 0;
+    float root_entry;
+    if (!ray_box(nodes_[0], ray.origin, inverse, best, root_entry)) return false;
+    stack[size++] = {0, root_entry};
+
+    while (size > 0) {
+      const Entry current = stack[--size];
+      if (current.entry > best) continue;
+      const Node &node = nodes_[current.node];
+
+      if (node.count > 0) {
+        const int lane = ray_pack(packs_[node.index], ray.origin, ray.direction, best);
+        if (lane >= 0) {
+          best_pack = node.index;
+          best_lane = lane;
+        }
+        continue;
+      }
+
+      // ---- Visit The Nearer Child First So best Shrinks Early ----
+      float left_entry, right_entry;
+      const bool left_hit = ray_box(nodes_[node.index], ray.origin, inverse, best, left_entry);
+      const bool right_hit = ray_box(nodes_[node.index + 1], ray.origin, inverse, best, right_entry);
+      if (left_hit && right_hit) {
+        const bool left_first = left_entry <= right_entry;
+        stack[size++] = left_first ? Entry{node.index + 1, right_entry} : Entry{node.index, left_entry};
+        stack[size++] = left_first ? Entry{node.index, left_entry} : Entry{node.index + 1, right_entry};
+      } else if (left_hit) {
+        stack[size++] = {node.index, left_entry};
+      } else if (right_hit) {
+        stack[size++] = {node.index + 1, right_entry};
+      }
+    }
+
+    if (best_lane < 0) return false;
+    const TrianglePack &pack = packs_[best_pack];
+    const glm::vec3 e1(pack.e1[0][best_lane], pack.e1[1][best_lane], pack.e1[2][best_lane]);
+    const glm::vec3 e2(pack.e2[0][best_lane], pack.e2[1][best_lane], pack.e2[2][best_lane]);
+    glm::vec3 normal = normalize(cross(e1, e2));
+    if (dot(normal, ray.direction) > 0.0f) normal = -normal;
+
+    hit.distance = best;
+    hit.normal = normal;
+    hit.triangle = pack.ids[best_lane];
+    return true;
+  }
+
+  bool CollisionMesh::sweep_capsule(const Capsule &capsule, const glm::vec3 &motion, SweepHit &hit) const {
+    if (nodes_.empty()) return false;
+
+    // ---- Candidates: Leaves Touching The Swept Capsule's Box ----
+    const glm::vec3 radius(capsule.radius + CONTACT_TOLERANCE);
+    const glm::vec3 minimum = min(min(capsule.a, capsule.b), min(capsule.a + motion, capsule.b + motion)) - radius;
+    const glm::vec3 maximum = max(max(capsule.a, capsule.b), max(capsule.a + motion, capsule.b + motion)) + radius;
+    thread_local std::vector<std::uint32_t> packs;
+    packs.clear();
+    query(minimum, maximum, packs);
+
+    bool found = false;
+    for (const std::uint32_t index : packs) {
+      const TrianglePack &pack = packs_[index];
+      for (std::uint32_t lane = 0; lane < LEAF_SIZE; lane++) {
+        if (pack.ids[lane] == NO_TRIANGLE) continue;
+        const glm::vec3 a(pack.v0[0][lane], pack.v0[1][lane], pack.v0[2][lane]);
+        const glm::vec3 b = a + glm::vec3(pack.e1[0][lane], pack.e1[1][lane], pack.e1[2][lane]);
+        const glm::vec3 c = a + glm::vec3(pack.e2[0][lane], pack.e2[1][lane], pack.e2[2][lane]);
+
+        // ---- Earliest Contact Wins; Among Overlaps, The Deepest ----
+        SweepHit candidate;
+        if (!sweep_triangle(capsule, motion, a, b, c, candidate)) continue;
+        if (!found || candidate.fraction < hit.fraction ||
+            (candidate.fraction == hit.fraction && candidate.depth > hit.depth)) {
+          hit = candidate;
+          found = true;
+        }
+      }
+    }
+    return found;
+  }
+} // STARBORN
@@ -0,0 +1,72 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "CollisionScene.hpp"
+
+namespace STARBORN {
+  namespace {
+    glm::vec3 to_point(const glm::mat4 &matrix, const glm::vec3 &point) {
+      return glm::vec3(matrix * glm::vec4(point, 1.0f));
+    }
+
+    glm::vec3 to_direction(const glm::mat4 &matrix, const glm::vec3 &direction) {
+      return glm::vec3(matrix * glm::vec4(direction, 0.0f));
+    }
+  }
+
+  // ---- Instances ----
+  std::uint32_t CollisionScene::add(const CollisionMesh &mesh, const glm::mat4 &transform) {
+    const auto instance = static_cast<std::uint32_t>(instances_.size());
+    instances_.push_back({&mesh, transform, glm::mat4(1.0f), 1.0f});
+    set_transform(instance, transform);
+    return instance;
+  }
+
+  void CollisionScene::set_transform(const std::uint32_t instance, const glm::mat4 &transform) {
+    Instance &target = instances_[instance];
+    target.transform = transform;
+    target.inverse = inverse(transform);
+    target.scale = length(glm::vec3(transform[0]));
+  }
+
+  // ---- Queries ----
+  bool CollisionScene::raycast(const Ray &ray, RayHit &hit) const {
+    bool found = false;
+    float best = ray.max_distance;
+    for (const auto &instance : instances_) {
+      // ---- Local Distances Are World Distances Over The Scale ----
+      const Ray local{to_point(instance.inverse, ray.origin), normalize(to_direction(instance.inverse, ray.direction)),
+                      best / instance.scale};
+      RayHit local_hit;
+      if (!instance.mesh->raycast(local, local_hit)) continue;
+
+      best = local_hit.distance * instance.scale;
+      hit.distance = best;
+      hit.normal = normalize(to_direction(instance.transform, local_hit.normal));
+      hit.triangle = local_hit.triangle;
+      found = true;
+    }
+    return found;
+  }
+
+  bool CollisionScene::sweep_capsule(const Capsule &capsule, const glm::vec3 &motion, SweepHit &hit) const {
+    bool found = false;
+    for (const auto &instance : instances_) {
+      const Capsule local{to_point(instance.inverse, capsule.a), to_point(instance.inverse, capsule.b),
+                          capsule.radius / instance.scale};
+      SweepHit local_hit;
+      if (!instance.mesh->sweep_capsule(local, to_direction(instance.inverse, motion), local_hit)) continue;
+
+      // ---- Fractions Survive The Transform; Depth Scales Back Up ----
+      if (found && (local_hit.fraction > hit.fraction ||
+                    (local_hit.fraction == hit.fraction && local_hit.depth * instance.scale <= hit.depth))) continue;
+      hit.fraction = local_hit.fraction;
+      hit.normal = normalize(to_direction(instance.transform, local_hit.normal));
+      hit.point = to_point(instance.transform, local_hit.point);
+      hit.depth = local_hit.depth * instance.scale;
+      found = true;
+    }
+    return found;
+  }
+} // STARBORN
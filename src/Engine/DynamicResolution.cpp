@@ -0,0 +1,106 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "DynamicResolution.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  namespace {
+    // ---- Controller Tuning ----
+    constexpr float SMOOTHING = 0.1f;
+    constexpr float OVER_BUDGET = 1.05f;
+    constexpr float UNDER_BUDGET = 0.85f;
+    constexpr int COOLDOWN_FRAMES = 15;
+  }
+
+  // ---- Lifecycle ----
+  void DynamicResolution::init() {
+    if (queries_[0] == 0) glGenQueries(QUERY_COUNT, queries_.data());
+    query_pending_.fill(false);
+    query_index_ = 0;
+  }
+
+  void DynamicResolution::cleanup() {
+    if (queries_[0] != 0) glDeleteQueries(QUERY_COUNT, queries_.data());
+    queries_.fill(0);
+  }
+
+  // ---- Frame ----
+  void DynamicResolution::begin_frame() {
+    timing_ = false;
+    if (queries_[0] == 0) return;
+
+    // ---- Ring Full: Skip Timing This Frame Rather Than Wait On The GPU ----
+    collect_results();
+    if (query_pending_[query_index_]) return;
+
+    glBeginQuery(GL_TIME_ELAPSED, queries_[query_index_]);
+    query_pending_[query_index_] = true;
+    timing_ = true;
+  }
+
+  void DynamicResolution::end_frame() {
+    if (!timing_) return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    timing_ = false;
+    query_index_ = (query_index_ + 1) % QUERY_COUNT;
+  }
+
+  void DynamicResolution::collect_results() {
+    // ---- Oldest First, Stop At The First Result Not Yet Available ----
+    // The slot about to be reused is the oldest one, so the walk starts there.
+    for (int i = 0; i < QUERY_COUNT; i++) {
+      const int index = (query_index_ + i) % QUERY_COUNT;
+      if (!query_pending_[index]) continue;
+
+      unsigned int available = 0;
+      glGetQueryObjectuiv(queries_[index], GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available) break;
+
+      GLuint64 elapsed_ns = 0;
+      glGetQueryObjectui64v(queries_[index], GL_QUERY_RESULT, &elapsed_ns);
+      query_pending_[index] = false;
+      adjust(static_cast<float>(elapsed_ns) / 1.0e6f);
+    }
+  }
+
+  void DynamicResolution::adjust(const float frame_ms) {
+    gpu_time_ms_ = gpu_time_ms_ == 0.0f ? frame_ms : gpu_time_ms_ + (frame_ms - gpu_time_ms_) * SMOOTHING;
+
+    // ---- Let The Previous Change Show Up In The Measurements First ----
+    if (!config_.enabled || cooldown_frames_ > 0) {
+      cooldown_frames_ = std::max(cooldown_frames_ - 1, 0);
+      return;
+    }
+
+    const float ratio = gpu_time_ms_ / config_.target_frame_ms;
+    if (ratio < OVER_BUDGET && ratio > UNDER_BUDGET) return;
+
+    // ---- Fill Cost Scales With Area, So Correct By The Square Root ----
+    float target = scale_ / std::sqrt(ratio);
+    if (ratio < 1.0f) target = std::min(target, scale_ + config_.step);
+    target = std::round(target / config_.step) * config_.step;
+    target = std::clamp(target, config_.min_scale, config_.max_scale);
+
+    if (target != scale_) {
+      scale_ = target;
+      cooldown_frames_ = COOLDOWN_FRAMES;
+    }
+  }
+
+  // ---- Getters ----
+  glm::ivec2 DynamicResolution::get_render_size(const int width, const int height) const {
+    const float scale = get_scale();
+    return {std::max(1, static_cast<int>(static_cast<float>(width) * scale)),
+            std::max(1, static_cast<int>(static_cast<float>(height) * scale))};
+  }
+
+  // ---- Setters ----
+  void DynamicResolution::set_config(const Config &config) {
+    config_ = config;
+    scale_ = std::clamp(scale_, config_.min_scale, config_.max_scale);
+  }
+} // STARBORN
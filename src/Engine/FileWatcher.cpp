@@ -0,0 +1,117 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "FileWatcher.hpp"
+#include <algorithm>
+#include <iostream>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#else
+#include <GLFW/glfw3.h>
+#endif
+
+namespace STARBORN {
+  namespace {
+    std::string normalize(const std::filesystem::path &path) {
+      return path.lexically_normal().generic_string();
+    }
+  }
+
+#ifdef __linux__
+  // ---- Constructor & Destructor ----
+  FileWatcher::FileWatcher() {
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) std::cerr << "ERROR::FILE_WATCHER::INOTIFY_INIT_FAILED" << std::endl;
+  }
+
+  FileWatcher::~FileWatcher() {
+    if (fd_ >= 0) close(fd_);
+  }
+
+  // ---- Watching ----
+  void FileWatcher::watch(const std::string &path) {
+    const std::string file = normalize(path);
+    if (fd_ < 0 || !files_.insert(file).second) return;
+
+    std::string directory = normalize(std::filesystem::path(file).parent_path());
+    if (directory.empty()) directory = ".";
+
+    for (const auto &[wd, watched] : directories_) {
+      if (watched == directory) return;
+    }
+
+    const int wd = inotify_add_watch(fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0) {
+      std::cerr << "ERROR::FILE_WATCHER::CANNOT_WATCH " << directory << std::endl;
+      return;
+    }
+    directories_[wd] = directory;
+  }
+
+  // ---- Polling ----
+  std::vector<std::string> FileWatcher::poll() {
+    std::vector<std::string> changed;
+    if (fd_ < 0) return changed;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+      const ssize_t length = read(fd_, buffer, sizeof(buffer));
+      if (length <= 0) break;
+
+      for (ssize_t offset = 0; offset < length;) {
+        const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+        const auto it = directories_.find(event->wd);
+        if (it == directories_.end() || event->len == 0) continue;
+
+        // ---- Coalesce Bursts From A Single Save ----
+        const std::string file = normalize(std::filesystem::path(it->second) / event->name);
+        if (files_.contains(file) && std::ranges::find(changed, file) == changed.end()) {
+          changed.push_back(file);
+        }
+      }
+    }
+
+    return changed;
+  }
+#else
+  // ---- Constructor & Destructor ----
+  FileWatcher::FileWatcher() = default;
+  FileWatcher::~FileWatcher() = default;
+
+  // ---- Watching ----
+  void FileWatcher::watch(const std::string &path) {
+    const std::string file = normalize(path);
+    if (!files_.insert(file).second) return;
+
+    std::error_code ec;
+    timestamps_[file] = std::filesystem::last_write_time(file, ec);
+  }
+
+  // ---- Polling ----
+  std::vector<std::string> FileWatcher::poll() {
+    std::vector<std::string> changed;
+
+    // ---- Stat Calls Are Not Free, Scan At Most Twice A Second ----
+    const double now = glfwGetTime();
+    if (now - last_scan_ < 0.5) return changed;
+    last_scan_ = now;
+
+    for (auto &[file, timestamp] : timestamps_) {
+      std::error_code ec;
+      const auto current = std::filesystem::last_write_time(file, ec);
+      if (ec || current == timestamp) continue;
+
+      timestamp = current;
+      changed.push_back(file);
+    }
+
+    return changed;
+  }
+#endif
+} // STARBORN
@@ -0,0 +1,35 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "FixedTimestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  // ---- Constructor ----
+  FixedTimestep::FixedTimestep(const double tick_rate, const int max_steps)
+    : step_(1.0 / std::max(tick_rate, 1.0)), max_steps_(std::max(max_steps, 1)) {}
+
+  // ---- Advance ----
+  int FixedTimestep::advance(const double now) {
+    // ---- First Frame Runs One Tick ----
+    if (last_time_ < 0.0) {
+      last_time_ = now;
+      return 1;
+    }
+
+    accumulator_ += now - last_time_;
+    last_time_ = now;
+
+    int steps = 0;
+    while (accumulator_ >= step_ && steps < max_steps_) {
+      accumulator_ -= step_;
+      steps++;
+    }
+
+    // ---- Too Far Behind: Drop The Backlog ----
+    if (accumulator_ >= step_) accumulator_ = std::fmod(accumulator_, step_);
+    return steps;
+  }
+} // STARBORN
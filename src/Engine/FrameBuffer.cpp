@@ -3,38 +3,151 @@
 */
 
 #include "FrameBuffer.hpp"
+#include "GLExtensions.hpp"
 
 namespace STARBORN {
+  namespace {
+    bool has_stencil(const GLenum format) {
+      return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
+    }
+
+    GLenum depth_attachment(const GLenum format) {
+      return has_stencil(format) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+    }
+
+    bool is_float_format(const GLenum format) {
+      return format == GL_RGBA16F || format == GL_RGB16F || format == GL_RGBA32F || format == GL_RGB32F ||
+             format == GL_R11F_G11F_B10F || format == GL_R16F || format == GL_RG16F;
+    }
+
+    // ---- Upload Format/Type Matching An Internal Format ----
+    void allocate_texture(const GLenum internal_format, const int width, const int height) {
+      GLenum format = GL_RGBA;
+      GLenum type = is_float_format(internal_format) ? GL_FLOAT : GL_UNSIGNED_BYTE;
+
+      if (internal_format == GL_DEPTH24_STENCIL8) {
+        format = GL_DEPTH_STENCIL;
+        type = GL_UNSIGNED_INT_24_8;
+      } else if (internal_format == GL_DEPTH32F_STENCIL8) {
+        format = GL_DEPTH_STENCIL;
+        type = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+      } else if (internal_format == GL_DEPTH_COMPONENT32F) {
+        format = GL_DEPTH_COMPONENT;
+        type = GL_FLOAT;
+      } else if (internal_format == GL_DEPTH_COMPONENT24 || internal_format == GL_DEPTH_COMPONENT16) {
+        format = GL_DEPTH_COMPONENT;
+        type = GL_UNSIGNED_INT;
+      }
+
+      glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(internal_format), width, height, 0, format, type, NULL);
+    }
+
+    unsigned int create_renderbuffer(const GLenum internal_format, const int samples, const int width, const int height) {
+      unsigned int renderbuffer;
+      glGenRenderbuffers(1, &renderbuffer);
+      glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+      if (samples > 1) glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, internal_format, width, height);
+      else glRenderbufferStorage(GL_RENDERBUFFER, internal_format, width, height);
+      return renderbuffer;
+    }
+
+    void set_draw_buffers(const std::size_t count) {
+      std::vector<GLenum> buffers(count);
+      for (std::size_t i = 0; i < count; i++) buffers[i] = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+      if (count == 0) glDrawBuffer(GL_NONE);
+      else glDrawBuffers(static_cast<GLsizei>(count), buffers.data());
+    }
+  }
+
   // ---- Constructor & Destructor ----
-   FrameBuffer::FrameBuffer(const int width, const int height) : width_(width), height_(height) {
+   FrameBuffer::FrameBuffer(const int width, const int height, const FrameBufferDesc &desc)
+     : desc_(desc), width_(width), height_(height) {
+     create_attachments();
+   }
+
+   FrameBuffer::~FrameBuffer() {
+     destroy_attachments();
+   }
+
+  void FrameBuffer::create_attachments() {
+     const bool multisampled = desc_.samples > 1;
+
      glGenFramebuffers(1, &FBO);
      glBindFramebuffer(GL_FRAMEBUFFER, FBO);
 
-     // ---- Color Attachment Texture ----
-     glGenTextures(1, &texture_color_buffer);
-     glBindTexture(GL_TEXTURE_2D, texture_color_buffer);
-     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture_color_buffer, 0);
+     // ---- Color Attachment Textures ----
+     color_textures_.resize(desc_.color_formats.size());
+     glGenTextures(static_cast<GLsizei>(color_textures_.size()), color_textures_.data());
+     for (std::size_t i = 0; i < color_textures_.size(); i++) {
+       glBindTexture(GL_TEXTURE_2D, color_textures_[i]);
+       allocate_texture(desc_.color_formats[i], width_, height_);
+       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+       glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), color_textures_[i], 0);
+     }
+     set_draw_buffers(color_textures_.size());
 
-     // ---- Render Buffer Object ----
-     glGenRenderbuffers(1, &rbo);
-     glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
-     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, rbo);
+     // ---- Depth: Sampleable Texture Or Render Buffer Object ----
+     if (desc_.depth_format != 0) {
+       if (desc_.depth_texture) {
+         glGenTextures(1, &depth_texture_);
+         glBindTexture(GL_TEXTURE_2D, depth_texture_);
+         allocate_texture(desc_.depth_format, width_, height_);
+         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+         glFramebufferTexture(GL_FRAMEBUFFER, depth_attachment(desc_.depth_format), depth_texture_, 0);
+       } else if (!multisampled) {
+         rbo = create_renderbuffer(desc_.depth_format, 1, width_, height_);
+         glFramebufferRenderbuffer(GL_FRAMEBUFFER, depth_attachment(desc_.depth_format), GL_RENDERBUFFER, rbo);
+       }
+     }
 
      if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) throw std::runtime_error("Framebuffer is not complete");
 
+     // ---- Multisampled Render Target, Resolved Into The Textures Above ----
+     if (multisampled) {
+       glGenFramebuffers(1, &msaa_FBO);
+       glBindFramebuffer(GL_FRAMEBUFFER, msaa_FBO);
+
+       for (std::size_t i = 0; i < desc_.color_formats.size(); i++) {
+         msaa_color_buffers_.push_back(create_renderbuffer(desc_.color_formats[i], desc_.samples, width_, height_));
+         glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i),
+                                   GL_RENDERBUFFER, msaa_color_buffers_.back());
+       }
+       set_draw_buffers(msaa_color_buffers_.size());
+
+       if (desc_.depth_format != 0) {
+         msaa_depth_buffer_ = create_renderbuffer(desc_.depth_format, desc_.samples, width_, height_);
+         glFramebufferRenderbuffer(GL_FRAMEBUFFER, depth_attachment(desc_.depth_format), GL_RENDERBUFFER, msaa_depth_buffer_);
+       }
+
+       if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) throw std::runtime_error("Multisampled framebuffer is not complete");
+     }
+
      glBindFramebuffer(GL_FRAMEBUFFER, 0);
-   }
+  }
 
-   FrameBuffer::~FrameBuffer() {
+  void FrameBuffer::destroy_attachments() {
      glDeleteFramebuffers(1, &FBO);
-   }
+     glDeleteTextures(static_cast<GLsizei>(color_textures_.size()), color_textures_.data());
+     glDeleteTextures(1, &depth_texture_);
+     glDeleteRenderbuffers(1, &rbo);
+     FBO = rbo = depth_texture_ = 0;
+     color_textures_.clear();
+
+     if (msaa_FBO) {
+       glDeleteFramebuffers(1, &msaa_FBO);
+       glDeleteRenderbuffers(static_cast<GLsizei>(msaa_color_buffers_.size()), msaa_color_buffers_.data());
+       glDeleteRenderbuffers(1, &msaa_depth_buffer_);
+     }
+     msaa_FBO = msaa_depth_buffer_ = 0;
+     msaa_color_buffers_.clear();
+  }
 
   void FrameBuffer::bind() const {
-     glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+     glBindFramebuffer(GL_FRAMEBUFFER, render_FBO());
   }
 
   void FrameBuffer::unbind() {
@@ -42,20 +155,58 @@ namespace STARBORN {
   }
 
   void FrameBuffer::resize(const int width, const int height) {
+     if (width == width_ && height == height_) return;
      width_ = width;
      height_ = height;
 
-     // ---- Recreate Texture ----
-     glBindTexture(GL_TEXTURE_2D, texture_color_buffer);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+     // ---- Recreate Every Attachment ----
+     destroy_attachments();
+     create_attachments();
+  }
 
-     // ---- Recreate RenderBuffer ----
-     glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+  // ---- End Of Pass ----
+  void FrameBuffer::resolve() const {
+     if (!msaa_FBO) return;
 
-     // ---- Check Framebuffer ----
-     glBindFramebuffer(GL_FRAMEBUFFER, FBO);
-     if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) throw std::runtime_error("Framebuffer is not complete");
+     glBindFramebuffer(GL_READ_FRAMEBUFFER, msaa_FBO);
+     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, FBO);
+
+     // ---- One Blit Per Color Attachment ----
+     for (std::size_t i = 0; i < color_textures_.size(); i++) {
+       const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+       glReadBuffer(attachment);
+       glDrawBuffer(attachment);
+       glBlitFramebuffer(0, 0, width_, height_, 0, 0, width_, height_, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+     }
+
+     if (desc_.depth_texture) {
+       const GLbitfield mask = GL_DEPTH_BUFFER_BIT | (has_stencil(desc_.depth_format) ? GL_STENCIL_BUFFER_BIT : 0);
+       glBlitFramebuffer(0, 0, width_, height_, 0, 0, width_, height_, mask, GL_NEAREST);
+     }
+
+     set_draw_buffers(color_textures_.size());
+     glReadBuffer(GL_COLOR_ATTACHMENT0);
+     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  }
+
+  void FrameBuffer::end_pass(const bool keep_contents) const {
+     resolve();
+     if (keep_contents || !GLExtensions::invalidate_framebuffer) return;
+
+     std::vector<GLenum> attachments;
+     const GLenum depth = desc_.depth_format != 0 ? depth_attachment(desc_.depth_format) : GL_NONE;
+
+     // ---- Multisampled Storage Is Dead Once Resolved ----
+     if (msaa_FBO) {
+       for (std::size_t i = 0; i < msaa_color_buffers_.size(); i++) attachments.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
+       if (depth != GL_NONE) attachments.push_back(depth);
+     } else if (!desc_.depth_texture && depth != GL_NONE) {
+       attachments.push_back(depth);
+     }
+
+     if (attachments.empty()) return;
+     glBindFramebuffer(GL_FRAMEBUFFER, render_FBO());
+     GLExtensions::invalidate_framebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(attachments.size()), attachments.data());
      glBindFramebuffer(GL_FRAMEBUFFER, 0);
   }
-}
\ No newline at end of file
+}
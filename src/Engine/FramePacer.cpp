@@ -0,0 +1,110 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace STARBORN {
+  namespace {
+    // ---- OS Sleep Overshoots; Spin Through The Last Stretch ----
+    constexpr auto SPIN_MARGIN = std::chrono::microseconds(1500);
+    constexpr GLuint64 FENCE_TIMEOUT_NS = 100'000'000;
+  }
+
+  // ---- Lifecycle ----
+  void FramePacer::init(GLFWwindow *window, const Config &config) {
+    window_ = window;
+    set_config(config);
+  }
+
+  void FramePacer::cleanup() {
+    for (auto &fence : fences_) {
+      if (fence) glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+
+  // ---- Frame ----
+  void FramePacer::wait_for_gpu() {
+    if (fences_.empty()) return;
+
+    // ---- Oldest Fence In The Ring Is The Next One To Be Replaced ----
+    GLsync &fence = fences_[fence_index_];
+    if (!fence) return;
+
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+    glDeleteSync(fence);
+    fence = nullptr;
+  }
+
+  void FramePacer::end_frame() {
+    if (!fences_.empty()) {
+      GLsync &fence = fences_[fence_index_];
+      if (fence) glDeleteSync(fence);
+      fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      fence_index_ = (fence_index_ + 1) % static_cast<int>(fences_.size());
+    }
+
+    if (config_.mode == Mode::FIXED_RATE) wait_for_deadline();
+  }
+
+  void FramePacer::wait_for_deadline() {
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0 / std::max(config_.frame_rate, 1.0)));
+    const auto now = Clock::now();
+
+    // ---- Fell Behind By More Than A Frame: Restart Instead Of Bursting To Catch Up ----
+    if (next_deadline_ == Clock::time_point{} || now - next_deadline_ > period) {
+      next_deadline_ = now + period;
+      return;
+    }
+
+    if (next_deadline_ - now > SPIN_MARGIN) std::this_thread::sleep_until(next_deadline_ - SPIN_MARGIN);
+    while (Clock::now() < next_deadline_) std::this_thread::yield();
+
+    next_deadline_ += period;
+  }
+
+  // ---- Setters ----
+  void FramePacer::set_config(const Config &config) {
+    cleanup();
+    config_ = config;
+    config_.max_frames_in_flight = std::max(config_.max_frames_in_flight, 1);
+    fences_.assign(config_.max_frames_in_flight, nullptr);
+    fence_index_ = 0;
+    next_deadline_ = {};
+    apply_swap_interval();
+  }
+
+  void FramePacer::apply_swap_interval() const {
+    if (!window_) return;
+
+    switch (config_.mode) {
+      case Mode::VSYNC:
+        glfwSwapInterval(1);
+        break;
+      case Mode::ADAPTIVE_VSYNC:
+        // ---- Negative Interval Needs EXT_swap_control_tear, Otherwise Plain VSync ----
+        if (glfwExtensionSupported("GLX_EXT_swap_control_tear") || glfwExtensionSupported("WGL_EXT_swap_control_tear")) {
+          glfwSwapInterval(-1);
+        } else {
+          glfwSwapInterval(1);
+        }
+        break;
+      case Mode::UNCAPPED:
+      case Mode::FIXED_RATE:
+        glfwSwapInterval(0);
+        break;
+    }
+  }
+
+  // ---- Parsing ----
+  FramePacer::Mode FramePacer::parse_mode(const std::string &name) {
+    if (name == "uncapped") return Mode::UNCAPPED;
+    if (name == "adaptive") return Mode::ADAPTIVE_VSYNC;
+    if (name == "fixed") return Mode::FIXED_RATE;
+    return Mode::VSYNC;
+  }
+} // STARBORN
@@ -0,0 +1,93 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "GLExtensions.hpp"
+#include <GLFW/glfw3.h>
+#include <cstring>
+
+namespace STARBORN {
+  namespace GLExtensions {
+    PFN_GET_PROGRAM_BINARY get_program_binary = nullptr;
+    PFN_PROGRAM_BINARY program_binary = nullptr;
+    PFN_PROGRAM_PARAMETERI program_parameteri = nullptr;
+    PFN_MAX_SHADER_COMPILER_THREADS max_shader_compiler_threads = nullptr;
+    PFN_INVALIDATE_FRAMEBUFFER invalidate_framebuffer = nullptr;
+    PFN_CLIP_CONTROL clip_control = nullptr;
+
+    namespace {
+      int gl_major = 0;
+      int gl_minor = 0;
+      bool parallel_shader_compile = false;
+
+      bool version_at_least(const int major, const int minor) {
+        return gl_major > major || (gl_major == major && gl_minor >= minor);
+      }
+
+      template <typename T>
+      T get_proc(const char *name) {
+        return reinterpret_cast<T>(glfwGetProcAddress(name));
+      }
+    }
+
+    // ---- Loading ----
+    void load() {
+      glGetIntegerv(GL_MAJOR_VERSION, &gl_major);
+      glGetIntegerv(GL_MINOR_VERSION, &gl_minor);
+
+      // ---- Program Binaries ----
+      if (version_at_least(4, 1) || has_extension("GL_ARB_get_program_binary")) {
+        get_program_binary = get_proc<PFN_GET_PROGRAM_BINARY>("glGetProgramBinary");
+        program_binary = get_proc<PFN_PROGRAM_BINARY>("glProgramBinary");
+        program_parameteri = get_proc<PFN_PROGRAM_PARAMETERI>("glProgramParameteri");
+      }
+
+      // ---- Framebuffer Invalidation ----
+      if (version_at_least(4, 3) || has_extension("GL_ARB_invalidate_subdata")) {
+        invalidate_framebuffer = get_proc<PFN_INVALIDATE_FRAMEBUFFER>("glInvalidateFramebuffer");
+      }
+
+      // ---- Clip Control ----
+      if (version_at_least(4, 5) || has_extension("GL_ARB_clip_control")) {
+        clip_control = get_proc<PFN_CLIP_CONTROL>("glClipControl");
+      }
+
+      // ---- Parallel Shader Compile ----
+      if (has_extension("GL_KHR_parallel_shader_compile")) {
+        parallel_shader_compile = true;
+        max_shader_compiler_threads = get_proc<PFN_MAX_SHADER_COMPILER_THREADS>("glMaxShaderCompilerThreadsKHR");
+      } else if (has_extension("GL_ARB_parallel_shader_compile")) {
+        parallel_shader_compile = true;
+        max_shader_compiler_threads = get_proc<PFN_MAX_SHADER_COMPILER_THREADS>("glMaxShaderCompilerThreadsARB");
+      }
+    }
+
+    bool has_extension(const char *name) {
+      int count = 0;
+      glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+      for (int i = 0; i < count; i++) {
+        const auto *extension = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i));
+        if (extension && std::strcmp(extension, name) == 0) return true;
+      }
+      return false;
+    }
+
+    // ---- Feature Queries ----
+    bool has_program_binary() {
+      if (!get_program_binary || !program_binary || !program_parameteri) return false;
+
+      // ---- Drivers May Expose The Entry Points With Zero Formats ----
+      int formats = 0;
+      glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+      return formats > 0;
+    }
+
+    bool has_parallel_shader_compile() {
+      return parallel_shader_compile;
+    }
+
+    bool has_clip_control() {
+      return clip_control != nullptr;
+    }
+  }
+}
@@ -3,6 +3,7 @@
 */
 
 #include "Input.hpp"
+#include <algorithm>
 
 namespace STARBORN {
   // ---- Initialization ----
@@ -17,51 +18,156 @@ namespace STARBORN {
 
     // ---- Disable Cursor ----
     glfwSetInputMode(window_, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+
+    // ---- Unaccelerated Motion For Mouse Look, Where The Platform Has It ----
+    if (glfwRawMouseMotionSupported()) glfwSetInputMode(window_, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE);
   }
 
   // ---- Update ----
   void Input::update() {
-    previous_keys_ = current_keys_;
-    previous_mouse_buttons_ = current_mouse_buttons_;
-    previous_cursor_position_ = current_cursor_position_;
+    // ---- No Late Poll Last Frame: Everything Counted As Ticked ----
+    if (!latched_) latch();
+
+    previous_keys_ = latched_keys_;
+    previous_mouse_buttons_ = latched_mouse_buttons_;
+    previous_cursor_position_ = latched_cursor_position_;
+
+    // ---- Events Applied Late Last Frame Are Reported With This One ----
+    std::copy(events_.begin() + static_cast<std::ptrdiff_t>(late_begin_),
+              events_.begin() + static_cast<std::ptrdiff_t>(event_count_), events_.begin());
+    event_count_ -= late_begin_;
+    late_begin_ = 0;
+    latched_ = false;
 
     scroll_delta_ = 0.0f;
+    for (std::size_t i = 0; i < event_count_; i++) {
+      if (events_[i].type == InputEvent::Type::SCROLL) scroll_delta_ += events_[i].y;
+    }
+
+    drain();
   }
 
-  // ---- Static Callbacks ----
-  void Input::key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+  void Input::poll() {
+    if (!latched_) latch();
+    drain();
+  }
+
+  void Input::latch() {
+    latched_keys_ = current_keys_;
+    latched_mouse_buttons_ = current_mouse_buttons_;
+    latched_cursor_position_ = current_cursor_position_;
+    late_begin_ = event_count_;
+    latched_ = true;
+  }
+
+  void Input::drain() {
+    queue_.drain([this](const InputEvent &event) { apply_event(event); });
+  }
+
+  void Input::enqueue(const InputEvent &event) {
     auto& input = get_instance();
-    input.current_keys_[key] = (action != GLFW_RELEASE);
+    if (!input.live_.load(std::memory_order_relaxed)) return;
+    if (!input.queue_.push(event)) input.queue_overflows_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // ---- Event Queue ----
+  bool Input::push_event(const InputEvent &event) {
+    // ---- Merge Motion Into The Previous Event Of The Same Kind ----
+    // Never across the latch, so late events stay separate for next frame.
+    const std::size_t merge_floor = latched_ ? late_begin_ : 0;
+    if (event_count_ > merge_floor && events_[event_count_ - 1].type == event.type) {
+      auto &last = events_[event_count_ - 1];
+      if (event.type == InputEvent::Type::CURSOR) {
+        last.x = event.x;
+        last.y = event.y;
+        last.time = event.time;
+        return true;
+      }
+      if (event.type == InputEvent::Type::SCROLL) {
+        last.x += event.x;
+        last.y += event.y;
+        last.time = event.time;
+        return true;
+      }
+    }
+
+    if (event_count_ == MAX_EVENTS) {
+      dropped_events_++;
+      return false;
+    }
+    events_[event_count_++] = event;
+    return true;
+  }
+
+  // ---- Apply ----
+  void Input::apply_event(const InputEvent &event) {
+    // ---- A Dropped Event Changes Nothing, So Recordings (Built From get_events()) Stay Exact ----
+    if (!push_event(event)) return;
+
+    last_event_time_ = event.time;
+    switch (event.type) {
+      case InputEvent::Type::KEY: {
+        if (is_valid_key(event.code)) {
+          const std::uint64_t mask = std::uint64_t{1} << (event.code & 63);
+          const std::uint64_t down = event.action != GLFW_RELEASE ? mask : 0;
+          auto &word = current_keys_[event.code >> 6];
+          word = (word & ~mask) | down;
+        }
+
+        // ---- Notify Callbacks ----
+        for (auto& callback : key_callbacks_) {
+          callback(event.code, event.action);
+        }
+        break;
+      }
+      case InputEvent::Type::MOUSE_BUTTON: {
+        if (is_valid_button(event.code)) {
+          const std::uint32_t mask = 1u << event.code;
+          const std::uint32_t down = event.action != GLFW_RELEASE ? mask : 0;
+          current_mouse_buttons_ = (current_mouse_buttons_ & ~mask) | down;
+        }
+        break;
+      }
+      case InputEvent::Type::CURSOR: {
+        current_cursor_position_ = glm::vec2(event.x, event.y);
 
-    // ---- Notify Callbacks ----
-    for (auto& callback : input.key_callbacks_) {
-      callback(key, action);
+        // ---- Notify Callbacks ----
+        for (auto& callback : mouse_callbacks_) {
+          callback(event.x, event.y);
+        }
+        break;
+      }
+      case InputEvent::Type::SCROLL: {
+        // ---- Several Wheel Ticks Can Land In One Frame ----
+        scroll_delta_ += event.y;
+
+        // ---- Notify Callbacks ----
+        for (auto& callback : scroll_callbacks_) {
+          callback(event.x, event.y);
+        }
+        break;
+      }
     }
   }
 
+  // ---- Static Callbacks ----
+  void Input::key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    enqueue({InputEvent::Type::KEY, static_cast<std::uint8_t>(action), static_cast<std::int16_t>(key),
+             0.0f, 0.0f, glfwGetTime()});
+  }
+
   void Input::mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
-    auto& input = get_instance();
-    input.current_mouse_buttons_[button] = (action != GLFW_RELEASE);
+    enqueue({InputEvent::Type::MOUSE_BUTTON, static_cast<std::uint8_t>(action), static_cast<std::int16_t>(button),
+             0.0f, 0.0f, glfwGetTime()});
   }
 
   void Input::cursor_position_callback(GLFWwindow *window, double x, double y) {
-    auto& input = get_instance();
-    input.current_cursor_position_ = glm::vec2(x, y);
-
-    // ---- Notify Callbacks ----
-    for (auto& callback : input.mouse_callbacks_) {
-      callback(x, y);
-    }
+    enqueue({InputEvent::Type::CURSOR, 0, 0, static_cast<float>(x), static_cast<float>(y), glfwGetTime()});
   }
 
   void Input::scroll_callback(GLFWwindow *window, double x_offset,
                               double y_offset) {
-    auto& input = get_instance();
-    input.scroll_delta_ = static_cast<float>(y_offset);
-
-    // ---- Notify Callbacks ----
-    for (auto& callback : input.scroll_callbacks_) {
-      callback(x_offset, y_offset);
-    }
+    enqueue({InputEvent::Type::SCROLL, 0, 0, static_cast<float>(x_offset), static_cast<float>(y_offset),
+             glfwGetTime()});
   }
-} // STARBORN
\ No newline at end of file
+} // STARBORN
@@ -0,0 +1,144 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "InputRecording.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace STARBORN {
+  namespace {
+    constexpr std::uint32_t RECORDING_MAGIC = 0x52494f53; // "SOIR"
+    constexpr std::uint32_t RECORDING_VERSION = 1;
+
+    // ---- Layout: Header, Then A FrameRecord Followed By Its EventRecords Per Frame ----
+    // Native byte order; recordings are meant for the machine that made them.
+    struct FileHeader {
+      std::uint32_t magic;
+      std::uint32_t version;
+      double tick_rate;
+    };
+
+    struct FrameRecord {
+      double time;
+      float alpha;
+      std::uint16_t ticks;
+      std::uint16_t event_count;
+    };
+
+    struct EventRecord {
+      std::uint8_t type;
+      std::uint8_t action;
+      std::int16_t code;
+      float x;
+      float y;
+      // Relative to FrameRecord::time, so a float keeps sub-millisecond precision.
+      float time_offset;
+    };
+
+    static_assert(sizeof(FrameRecord) == 16 && sizeof(EventRecord) == 16);
+  }
+
+  // ---- Recorder ----
+  bool InputRecorder::open(const std::string &path, const double tick_rate) {
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+      std::cerr << "ERROR::INPUT_RECORDER::OPEN_FAILED " << path << std::endl;
+      return false;
+    }
+
+    const FileHeader header{RECORDING_MAGIC, RECORDING_VERSION, tick_rate};
+    file_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    return true;
+  }
+
+  void InputRecorder::close() {
+    if (file_.is_open()) file_.close();
+  }
+
+  void InputRecorder::record_frame(const double time, const int ticks, const float alpha,
+                                   const std::span<const InputEvent> events) {
+    if (!file_.is_open()) return;
+
+    const auto event_count = std::min<std::size_t>(events.size(), std::numeric_limits<std::uint16_t>::max());
+    const FrameRecord frame{time, alpha, static_cast<std::uint16_t>(ticks), static_cast<std::uint16_t>(event_count)};
+    file_.write(reinterpret_cast<const char *>(&frame), sizeof(frame));
+
+    for (std::size_t i = 0; i < event_count; i++) {
+      const auto &event = events[i];
+      const EventRecord record{static_cast<std::uint8_t>(event.type), event.action, event.code,
+                               event.x, event.y, static_cast<float>(event.time - time)};
+      file_.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    }
+  }
+
+  // ---- Replay ----
+  bool InputReplay::load(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    FileHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || header.magic != RECORDING_MAGIC || header.version != RECORDING_VERSION) {
+      std::cerr << "ERROR::INPUT_REPLAY::INVALID_RECORDING " << path << std::endl;
+      return false;
+    }
+
+    tick_rate_ = header.tick_rate;
+    frames_.clear();
+    events_.clear();
+    next_frame_ = 0;
+
+    FrameRecord frame{};
+    while (file.read(reinterpret_cast<char *>(&frame), sizeof(frame))) {
+      frames_.push_back({frame.time, frame.ticks, frame.alpha,
+                         static_cast<std::uint32_t>(events_.size()), frame.event_count});
+
+      for (std::uint16_t i = 0; i < frame.event_count; i++) {
+        EventRecord record{};
+        if (!file.read(reinterpret_cast<char *>(&record), sizeof(record))) break;
+        events_.push_back({static_cast<InputEvent::Type>(record.type), record.action, record.code,
+                           record.x, record.y, frame.time + record.time_offset});
+      }
+    }
+
+    std::cout << "INPUT_REPLAY::LOADED " << path << " (" << frames_.size() << " FRAMES)" << std::endl;
+    frame_ms_.reserve(frames_.size());
+    return is_loaded();
+  }
+
+  std::optional<InputReplay::Step> InputReplay::next_frame(Input &input) {
+    // ---- Time Between Consecutive Frames Of The Run ----
+    const auto now = Clock::now();
+    if (last_frame_ != Clock::time_point{}) {
+      frame_ms_.push_back(std::chrono::duration<double, std::milli>(now - last_frame_).count());
+    }
+    last_frame_ = now;
+
+    if (next_frame_ >= frames_.size()) return std::nullopt;
+    const Frame &frame = frames_[next_frame_++];
+
+    const auto begin = events_.begin() + frame.first_event;
+    std::for_each(begin, begin + frame.event_count, [&](const InputEvent &event) { input.inject(event); });
+    return Step{frame.ticks, frame.alpha};
+  }
+
+  void InputReplay::report() const {
+    if (frame_ms_.empty()) return;
+
+    std::vector<double> sorted = frame_ms_;
+    std::sort(sorted.begin(), sorted.end());
+    const auto percentile = [&](const double p) {
+      return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(p * static_cast<double>(sorted.size())))];
+    };
+
+    double total = 0.0;
+    for (const double ms : sorted) total += ms;
+
+    std::cout << "INPUT_REPLAY::FRAME_TIMES " << sorted.size() << " FRAMES"
+              << " mean " << total / static_cast<double>(sorted.size()) << " ms"
+              << " p50 " << percentile(0.50) << " ms"
+              << " p95 " << percentile(0.95) << " ms"
+              << " p99 " << percentile(0.99) << " ms"
+              << " max " << sorted.back() << " ms" << std::endl;
+  }
+} // STARBORN
@@ -0,0 +1,162 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "JobSystem.hpp"
+
+namespace STARBORN {
+  namespace {
+    // ---- Which Queue This Thread Owns; -1 Outside The Pool ----
+    thread_local int worker_index = -1;
+  }
+
+  // ---- Constructor & Destructor ----
+  JobSystem::~JobSystem() { shutdown(); }
+
+  // ---- Lifecycle ----
+  void JobSystem::init(const unsigned int worker_count) {
+    shutdown();
+
+    stopping_ = false;
+    queues_.clear();
+    for (unsigned int i = 0; i <= worker_count; i++) queues_.push_back(std::make_unique<Queue>());
+
+    workers_.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; i++) {
+      workers_.emplace_back(&JobSystem::worker_loop, this, i);
+    }
+  }
+
+  void JobSystem::shutdown() {
+    if (workers_.empty()) return;
+
+    {
+      std::lock_guard lock(sleep_mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+    workers_.clear();
+  }
+
+  // ---- Submission ----
+  void JobSystem::submit(const Job &job) {
+    if (job.counter) job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+    if (workers_.empty()) {
+      run(job);
+      return;
+    }
+
+    {
+      auto &queue = *queues_[home_queue()];
+      std::lock_guard lock(queue.mutex);
+      queue.jobs.push_back(job);
+    }
+    queued_.fetch_add(1);
+    wake_workers(1);
+  }
+
+  void JobSystem::submit(std::function<void()> task, Counter &counter) {
+    Job job;
+    job.function = [](void *data, std::size_t, std::size_t) {
+      const std::unique_ptr<std::function<void()>> owned(static_cast<std::function<void()> *>(data));
+      (*owned)();
+    };
+    job.data = new std::function<void()>(std::move(task));
+    job.counter = &counter;
+    submit(job);
+  }
+
+  void JobSystem::wait(const Counter &counter) {
+    while (!counter.is_done()) {
+      if (!try_run_one()) std::this_thread::yield();
+    }
+  }
+
+  void JobSystem::push_range(const Function function, void *data, const std::size_t first,
+                             const std::size_t count, const std::size_t grain, Counter &counter) {
+    const std::size_t chunks = (count + grain - 1) / grain;
+    counter.pending.fetch_add(static_cast<int>(chunks), std::memory_order_relaxed);
+
+    {
+      auto &queue = *queues_[home_queue()];
+      std::lock_guard lock(queue.mutex);
+      for (std::size_t begin = first; begin < first + count; begin += grain) {
+        queue.jobs.push_back({function, data, begin, std::min(begin + grain, first + count), &counter});
+      }
+    }
+    queued_.fetch_add(static_cast<int>(chunks));
+    wake_workers(static_cast<int>(chunks));
+  }
+
+  void JobSystem::wake_workers(const int jobs) {
+    // ---- Skip The Lock Entirely While Everyone Is Busy ----
+    if (sleeping_.load() == 0) return;
+
+    std::lock_guard lock(sleep_mutex_);
+    if (jobs == 1) wake_.notify_one();
+    else wake_.notify_all();
+  }
+
+  // ---- Workers ----
+  void JobSystem::worker_loop(const std::size_t index) {
+    worker_index = static_cast<int>(index);
+
+    while (true) {
+      if (try_run_one()) continue;
+
+      std::unique_lock lock(sleep_mutex_);
+      if (stopping_ && queued_.load() == 0) break;
+
+      sleeping_.fetch_add(1);
+      wake_.wait(lock, [this] { return queued_.load() > 0 || stopping_; });
+      sleeping_.fetch_sub(1);
+    }
+
+    worker_index = -1;
+  }
+
+  bool JobSystem::try_run_one() {
+    if (queued_.load(std::memory_order_relaxed) == 0) return false;
+
+    const std::size_t home = home_queue();
+    const std::size_t queue_count = queues_.size();
+    Job job;
+    bool found = false;
+
+    // ---- Own Queue From The Back: Most Recent Work Is Still In Cache ----
+    {
+      auto &queue = *queues_[home];
+      std::lock_guard lock(queue.mutex);
+      if (!queue.jobs.empty()) {
+        job = queue.jobs.back();
+        queue.jobs.pop_back();
+        found = true;
+      }
+    }
+
+    // ---- Steal From The Front Of Everyone Else ----
+    for (std::size_t offset = 1; !found && offset < queue_count; offset++) {
+      auto &queue = *queues_[(home + offset) % queue_count];
+      std::lock_guard lock(queue.mutex);
+      if (queue.jobs.empty()) continue;
+      job = queue.jobs.front();
+      queue.jobs.pop_front();
+      found = true;
+    }
+
+    if (!found) return false;
+    queued_.fetch_sub(1);
+    run(job);
+    return true;
+  }
+
+  std::size_t JobSystem::home_queue() const {
+    return worker_index >= 0 ? static_cast<std::size_t>(worker_index) : queues_.size() - 1;
+  }
+
+  void JobSystem::run(const Job &job) {
+    job.function(job.data, job.begin, job.end);
+    if (job.counter) job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+  }
+} // STARBORN
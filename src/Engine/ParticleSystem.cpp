@@ -0,0 +1,178 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  namespace {
+    // position.xyz + age, velocity.xyz + lifetime.
+    constexpr GLsizei PARTICLE_STRIDE = 8 * sizeof(float);
+    // A hitch shouldn't fling every particle a long way in one step.
+    constexpr float MAX_DELTA_TIME = 0.1f;
+
+    void set_particle_attributes(const GLuint buffer, const GLuint divisor) {
+      glBindBuffer(GL_ARRAY_BUFFER, buffer);
+      glEnableVertexAttribArray(0);
+      glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, PARTICLE_STRIDE, nullptr);
+      glVertexAttribDivisor(0, divisor);
+      glEnableVertexAttribArray(1);
+      glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, PARTICLE_STRIDE, reinterpret_cast<void *>(4 * sizeof(float)));
+      glVertexAttribDivisor(1, divisor);
+    }
+  }
+
+  // ---- Emitter ----
+  FramePacket::ParticleEmission ParticleEmitter::extract() {
+    const float whole = std::floor(accumulator_);
+    accumulator_ -= whole;
+    const auto count = static_cast<std::uint32_t>(whole) + burst_;
+    burst_ = 0;
+    const bool teleport = teleport_;
+    teleport_ = false;
+    return {id_, position_, direction_, count, teleport};
+  }
+
+  // ---- Emitters ----
+  std::uint32_t ParticleSystem::add_emitter(const ParticleEmitterDesc &desc) {
+    emitters_.push_back({desc});
+    emitters_.back().desc.capacity = std::max(desc.capacity, 1u);
+    if (initialized_) create_buffers(emitters_.back());
+    return static_cast<std::uint32_t>(emitters_.size() - 1);
+  }
+
+  // ---- Lifecycle ----
+  void ParticleSystem::init() {
+    if (initialized_) return;
+    update_shader_ = std::make_unique<Shader>("assets/shaders/particle_update.vert",
+                                              "assets/shaders/particle_update.frag", true);
+    update_shader_->set_feedback_varyings({"outPositionAge", "outVelocityLife"});
+    update_shader_->finalize();
+
+    for (auto &emitter : emitters_) create_buffers(emitter);
+    initialized_ = true;
+  }
+
+  void ParticleSystem::cleanup() {
+    if (!initialized_) return;
+    for (auto &emitter : emitters_) {
+      glDeleteVertexArrays(2, emitter.update_vaos);
+      glDeleteVertexArrays(2, emitter.draw_vaos);
+      glDeleteBuffers(2, emitter.buffers);
+      emitter = {emitter.desc};
+    }
+    update_shader_.reset();
+    initialized_ = false;
+  }
+
+  void ParticleSystem::create_buffers(Emitter &emitter) const {
+    // ---- Zeroed Particles Have age == lifetime == 0, i.e. Dead ----
+    const std::vector<float> zeros(static_cast<std::size_t>(emitter.desc.capacity) * 8, 0.0f);
+    glGenBuffers(2, emitter.buffers);
+    glGenVertexArrays(2, emitter.update_vaos);
+    glGenVertexArrays(2, emitter.draw_vaos);
+
+    for (int i = 0; i < 2; i++) {
+      glBindBuffer(GL_ARRAY_BUFFER, emitter.buffers[i]);
+      glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(zeros.size() * sizeof(float)), zeros.data(), GL_DYNAMIC_COPY);
+
+      glBindVertexArray(emitter.update_vaos[i]);
+      set_particle_attributes(emitter.buffers[i], 0);
+      glBindVertexArray(emitter.draw_vaos[i]);
+      set_particle_attributes(emitter.buffers[i], 1);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  // ---- Frame ----
+  void ParticleSystem::simulate(const std::span<const FramePacket::ParticleEmission> emissions,
+                                const float delta_time) {
+    if (!initialized_) return;
+    frame_++;
+
+    // ---- Emitters Without An Emission This Frame Still Age Their Particles ----
+    lookup_.assign(emitters_.size(), nullptr);
+    for (const auto &emission : emissions) {
+      if (emission.emitter < lookup_.size()) lookup_[emission.emitter] = &emission;
+    }
+
+    // ---- Nothing Is Rasterized; Outputs Only Go To The Feedback Buffer ----
+    glEnable(GL_RASTERIZER_DISCARD);
+    update_shader_->use();
+    update_shader_->set_float("deltaTime", std::clamp(delta_time, 0.0f, MAX_DELTA_TIME));
+    for (std::size_t id = 0; id < emitters_.size(); id++) step(emitters_[id], lookup_[id]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glBindVertexArray(0);
+    glDisable(GL_RASTERIZER_DISCARD);
+  }
+
+  void ParticleSystem::step(Emitter &emitter, const FramePacket::ParticleEmission *emission) {
+    const ParticleEmitterDesc &desc = emitter.desc;
+    std::uint32_t spawn_count = 0;
+    glm::vec3 position = emitter.last_position;
+    glm::vec3 direction(0.0f, 1.0f, 0.0f);
+    if (emission) {
+      spawn_count = std::min(emission->spawn_count, desc.capacity);
+      position = emission->position;
+      direction = emission->direction;
+      // ---- Teleports And The First Spawn Don't Trail From The Old Position ----
+      if (emission->teleport || !emitter.placed) emitter.last_position = position;
+      if (spawn_count > 0) emitter.placed = true;
+    }
+
+    Shader &shader = *update_shader_;
+    shader.set_uint("capacity", desc.capacity);
+    shader.set_uint("spawnBegin", emitter.cursor);
+    shader.set_uint("spawnCount", spawn_count);
+    shader.set_uint("seed", frame_ * 0x9e3779b9u + static_cast<std::uint32_t>(&emitter - emitters_.data()));
+    shader.set_vec3("spawnFrom", emitter.last_position);
+    shader.set_vec3("spawnTo", position);
+    shader.set_vec3("direction", direction);
+    shader.set_float("spread", desc.spread);
+    shader.set_float("spawnRadius", desc.spawn_radius);
+    shader.set_vec2("speedRange", desc.speed_min, desc.speed_max);
+    shader.set_vec2("lifetimeRange", desc.lifetime_min, desc.lifetime_max);
+    shader.set_vec3("gravity", desc.gravity);
+    shader.set_float("drag", desc.drag);
+
+    // ---- Read current, Write The Other, Then Swap ----
+    const std::uint32_t next = 1 - emitter.current;
+    glBindVertexArray(emitter.update_vaos[emitter.current]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, emitter.buffers[next]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(desc.capacity));
+    glEndTransformFeedback();
+
+    emitter.current = next;
+    emitter.cursor = (emitter.cursor + spawn_count) % desc.capacity;
+    emitter.last_position = position;
+  }
+
+  void ParticleSystem::draw(const Shader &shader, const glm::mat4 &view, const glm::mat4 &projection) const {
+    if (!initialized_ || emitters_.empty()) return;
+
+    // ---- Additive: Order-Independent, So No Sort ----
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glDepthMask(GL_FALSE);
+
+    shader.use();
+    shader.set_mat4("view", view);
+    shader.set_mat4("projection", projection);
+    for (const auto &emitter : emitters_) {
+      if (!emitter.placed) continue;
+      shader.set_vec2("size", emitter.desc.size_start, emitter.desc.size_end);
+      shader.set_vec4("colorStart", emitter.desc.color_start);
+      shader.set_vec4("colorEnd", emitter.desc.color_end);
+      glBindVertexArray(emitter.draw_vaos[emitter.current]);
+      glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(emitter.desc.capacity));
+    }
+    glBindVertexArray(0);
+
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+  }
+} // STARBORN
@@ -0,0 +1,131 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "PhysicsWorld.hpp"
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace STARBORN {
+  namespace {
+    constexpr std::size_t INTEGRATE_GRAIN = 4096;
+    // Overlap left alone so resting contacts don't jitter.
+    constexpr float PENETRATION_SLOP = 0.001f;
+    constexpr float POSITION_CORRECTION = 0.8f;
+  }
+
+  // ---- Bodies ----
+  std::uint32_t PhysicsWorld::create_body(const glm::vec3 &position, const float radius, const float mass,
+                                          const glm::vec3 &velocity) {
+    const std::uint32_t body = broadphase_.create(position - glm::vec3(radius), position + glm::vec3(radius));
+    if (body >= positions_.size()) {
+      positions_.resize(body + 1);
+      velocities_.resize(body + 1);
+      radii_.resize(body + 1);
+      inverse_masses_.resize(body + 1);
+    }
+    positions_[body] = position;
+    velocities_[body] = velocity;
+    radii_[body] = radius;
+    inverse_masses_[body] = mass > 0.0f ? 1.0f / mass : 0.0f;
+    return body;
+  }
+
+  void PhysicsWorld::destroy_body(const std::uint32_t body) {
+    broadphase_.destroy(body);
+    // ---- Dead Slots Stay In The Arrays; Static And Still So Integration Skips Them ----
+    velocities_[body] = glm::vec3(0.0f);
+    inverse_masses_[body] = 0.0f;
+    radii_[body] = -1.0f;
+  }
+
+  void PhysicsWorld::clear() {
+    broadphase_.clear();
+    positions_.clear();
+    velocities_.clear();
+    radii_.clear();
+    inverse_masses_.clear();
+    contacts_.clear();
+  }
+
+  void PhysicsWorld::set_position(const std::uint32_t body, const glm::vec3 &position) {
+    positions_[body] = position;
+    const glm::vec3 extent(radii_[body]);
+    broadphase_.set_bounds(body, position - extent, position + extent);
+  }
+
+  // ---- Simulation ----
+  void PhysicsWorld::step(const float delta_time) {
+    integrate(delta_time);
+    broadphase_.update();
+    narrowphase();
+    resolve();
+  }
+
+  void PhysicsWorld::integrate(const float delta_time) {
+    JobSystem::get_instance().parallel_for(positions_.size(), INTEGRATE_GRAIN,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t body = begin; body < end; body++) {
+          if (inverse_masses_[body] == 0.0f) continue;
+          positions_[body] += velocities_[body] * delta_time;
+          const glm::vec3 extent(radii_[body]);
+          broadphase_.set_bounds(static_cast<std::uint32_t>(body), positions_[body] - extent, positions_[body] + extent);
+        }
+      });
+  }
+
+  void PhysicsWorld::narrowphase() {
+    const auto &pairs = broadphase_.get_pairs();
+    const std::size_t batches = (pairs.size() + NARROWPHASE_GRAIN - 1) / NARROWPHASE_GRAIN;
+    if (batch_contacts_.size() < batches) batch_contacts_.resize(batches);
+
+    // ---- Same Grain-Aligned Batching As The Broadphase Sweep ----
+    JobSystem::get_instance().parallel_for(pairs.size(), NARROWPHASE_GRAIN,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t batch = begin / NARROWPHASE_GRAIN; batch * NARROWPHASE_GRAIN < end; batch++) {
+          std::vector<Contact> &contacts = batch_contacts_[batch];
+          contacts.clear();
+          const std::size_t last = std::min(end, (batch + 1) * NARROWPHASE_GRAIN);
+          for (std::size_t i = batch * NARROWPHASE_GRAIN; i < last; i++) {
+            const auto [a, b] = pairs[i];
+            if (inverse_masses_[a] == 0.0f && inverse_masses_[b] == 0.0f) continue;
+
+            const glm::vec3 delta = positions_[b] - positions_[a];
+            const float radius = radii_[a] + radii_[b];
+            const float distance_squared = dot(delta, delta);
+            if (distance_squared >= radius * radius) continue;
+
+            const float distance = std::sqrt(distance_squared);
+            const glm::vec3 normal = distance > 1e-6f ? delta / distance : glm::vec3(0.0f, 1.0f, 0.0f);
+            const float normal_velocity = dot(velocities_[b] - velocities_[a], normal);
+            contacts.push_back({a, b, normal, radius - distance, normal_velocity});
+          }
+        }
+      });
+
+    contacts_.clear();
+    for (std::size_t batch = 0; batch < batches; batch++) {
+      contacts_.insert(contacts_.end(), batch_contacts_[batch].begin(), batch_contacts_[batch].end());
+    }
+  }
+
+  void PhysicsWorld::resolve() {
+    // ---- Sequential: Contacts Share Bodies, And Order Keeps Replays Deterministic ----
+    for (const auto &contact : contacts_) {
+      const float inverse_a = inverse_masses_[contact.a], inverse_b = inverse_masses_[contact.b];
+      const float inverse_sum = inverse_a + inverse_b;
+
+      const float approach = dot(velocities_[contact.b] - velocities_[contact.a], contact.normal);
+      if (approach < 0.0f) {
+        const glm::vec3 impulse = contact.normal * (-(1.0f + restitution_) * approach / inverse_sum);
+        velocities_[contact.a] -= impulse * inverse_a;
+        velocities_[contact.b] += impulse * inverse_b;
+      }
+
+      const float correction = std::max(contact.depth - PENETRATION_SLOP, 0.0f) * POSITION_CORRECTION / inverse_sum;
+      positions_[contact.a] -= contact.normal * (correction * inverse_a);
+      positions_[contact.b] += contact.normal * (correction * inverse_b);
+    }
+  }
+} // STARBORN
@@ -0,0 +1,83 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "PoseCache.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace STARBORN {
+  namespace {
+    constexpr int MIN_SLOT_BITS = 6;
+  }
+
+  // ---- Table ----
+  PoseCache::Slot &PoseCache::find_slot(const Key &key) {
+    // ---- Fibonacci Hashing: The Top Bits Of The Product Mix Clip And Step ----
+    constexpr std::uint64_t GOLDEN = 0x9e3779b97f4a7c15ull;
+    const std::uint64_t mixed = reinterpret_cast<std::uintptr_t>(key.clip) ^ static_cast<std::uint64_t>(key.step) * GOLDEN;
+    const std::uint64_t hash = mixed * GOLDEN;
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t index = static_cast<std::size_t>(hash >> (64 - slot_bits_));
+    while (slots_[index].entry && !(slots_[index].key == key)) index = (index + 1) & mask;
+    return slots_[index];
+  }
+
+  void PoseCache::grow() {
+    std::vector<Slot> previous = std::move(slots_);
+    slot_bits_ = std::max(slot_bits_ + 1, MIN_SLOT_BITS);
+    slots_.assign(std::size_t{1} << slot_bits_, Slot{});
+    for (const Slot &slot : previous) {
+      if (slot.entry) find_slot(slot.key) = slot;
+    }
+  }
+
+  // ---- Cache ----
+  void PoseCache::clear() {
+    std::ranges::fill(slots_, Slot{});
+    used_ = 0;
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+  }
+
+  const PoseCache::CachedPose &PoseCache::evaluate(const Skeleton &skeleton, const CompressedClip &clip,
+                                                   const float time) {
+    const auto step = static_cast<std::int64_t>(std::llround(time / time_step_));
+    Entry *entry;
+    bool owner = false;
+
+    // ---- Find Or Claim The Entry; Sampling Happens Outside The Lock ----
+    {
+      std::lock_guard lock(mutex_);
+      if ((used_ + 1) * 2 > slots_.size()) grow();
+
+      const Key key{&clip, step};
+      Slot &slot = find_slot(key);
+      if (!slot.entry) {
+        if (used_ == entries_.size()) entries_.push_back(std::make_unique<Entry>());
+        slot.key = key;
+        slot.entry = entries_[used_++].get();
+        slot.entry->ready.store(false, std::memory_order_relaxed);
+        owner = true;
+      }
+      entry = slot.entry;
+    }
+
+    if (owner) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      CachedPose &result = entry->result;
+      result.pose.assign(skeleton.bind_pose.begin(), skeleton.bind_pose.end());
+      sample(clip, std::clamp(static_cast<float>(step) * time_step_, 0.0f, clip.duration), result.pose);
+      result.palette.resize(std::min(skeleton.get_bone_count(), MAX_JOINTS));
+      compute_skinning(skeleton, result.pose, entry->joints, result.palette);
+      entry->ready.store(true, std::memory_order_release);
+      return result;
+    }
+
+    // ---- Someone Else Is Sampling This One; It Takes Microseconds ----
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    while (!entry->ready.load(std::memory_order_acquire)) std::this_thread::yield();
+    return entry->result;
+  }
+} // STARBORN
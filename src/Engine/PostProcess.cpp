@@ -0,0 +1,179 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "PostProcess.hpp"
+#include "ShaderLibrary.hpp"
+#include "ScreenQuad.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace STARBORN {
+  namespace {
+    constexpr int DITHER_SIZE = 8;
+    constexpr GLenum LUT_UNIT = 1;
+    constexpr GLenum DITHER_UNIT = 2;
+  }
+
+  // ---- Constructor ----
+  PostProcess::PostProcess()
+    : shaders_("post", "assets/shaders/post.vert", "assets/shaders/post.frag",
+               {"APPLY_QUANTIZE", "APPLY_DITHER", "APPLY_SHARPEN"}, "blit_fallback") {}
+
+  // ---- Lifecycle ----
+  void PostProcess::init() {
+    auto &library = ShaderLibrary::get_instance();
+    library.request("blit_fallback", "../shaders/fallback_blit.vert", "../shaders/fallback_blit.frag");
+    library.finish("blit_fallback");
+    shaders_.request(effects_);
+    library.compile_all();
+
+    if (!palette_lut_) glGenTextures(1, &palette_lut_);
+    if (!dither_texture_) {
+      glGenTextures(1, &dither_texture_);
+      build_dither_texture();
+    }
+    lut_dirty_ = true;
+  }
+
+  void PostProcess::cleanup() {
+    if (palette_lut_) glDeleteTextures(1, &palette_lut_);
+    if (dither_texture_) glDeleteTextures(1, &dither_texture_);
+    palette_lut_ = 0;
+    dither_texture_ = 0;
+  }
+
+  // ---- Lookup Textures ----
+  void PostProcess::build_palette_lut() {
+    // ---- Bake quantize(color) For Every Cell ----
+    const float levels = static_cast<float>(std::max(color_levels_, 2)) - 1.0f;
+    std::vector<unsigned char> texels(LUT_SIZE * LUT_SIZE * LUT_SIZE * 3);
+
+    std::size_t i = 0;
+    for (int b = 0; b < LUT_SIZE; b++) {
+      for (int g = 0; g < LUT_SIZE; g++) {
+        for (int r = 0; r < LUT_SIZE; r++) {
+          for (const int channel : {r, g, b}) {
+            const float color = (static_cast<float>(channel) + 0.5f) / LUT_SIZE;
+            const float quantized = std::floor(color * levels + 0.5f) / levels;
+            const float value = color + (quantized - color) * quantize_intensity_;
+            texels[i++] = static_cast<unsigned char>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+          }
+        }
+      }
+    }
+
+    // ---- Nearest Filtering Keeps The Palette Steps Hard ----
+    glBindTexture(GL_TEXTURE_3D, palette_lut_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB8, LUT_SIZE, LUT_SIZE, LUT_SIZE, 0, GL_RGB, GL_UNSIGNED_BYTE, texels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    lut_dirty_ = false;
+  }
+
+  void PostProcess::build_dither_texture() {
+    // ---- Bayer Matrix: Interleave (x ^ y, y) Bits, Finest Level First ----
+    unsigned char texels[DITHER_SIZE * DITHER_SIZE];
+    for (int y = 0; y < DITHER_SIZE; y++) {
+      for (int x = 0; x < DITHER_SIZE; x++) {
+        int value = 0;
+        for (int bit = 0, xs = x, ys = y; bit < 3; bit++, xs >>= 1, ys >>= 1) {
+          value = (value << 2) | (((xs ^ ys) & 1) << 1) | (ys & 1);
+        }
+        texels[y * DITHER_SIZE + x] = static_cast<unsigned char>((value * 255 + 31) / 63);
+      }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, dither_texture_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, DITHER_SIZE, DITHER_SIZE, 0, GL_RED, GL_UNSIGNED_BYTE, texels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  }
+
+  // ---- Draw ----
+  void PostProcess::apply(const unsigned int source_texture) {
+    if (lut_dirty_ && (effects_ & QUANTIZE)) build_palette_lut();
+
+    auto &shader = shaders_.get(effects_);
+    shader.use();
+
+    // ---- Uniforms Persist Per Program, Upload Only On Change ----
+    if (uniforms_dirty_ || last_program_ != shader.ID) {
+      const float levels = (effects_ & QUANTIZE) ? static_cast<float>(std::max(color_levels_, 2)) : 256.0f;
+      shader.set_int("screenTexture", 0);
+      shader.set_int("paletteLut", LUT_UNIT);
+      shader.set_int("ditherTexture", DITHER_UNIT);
+      shader.set_float("ditherScale", dither_intensity_ / (levels - 1.0f));
+
+      // ---- Upsampling: Sample Only The Rendered Region, Never Across Its Edge ----
+      const glm::vec2 source(source_size_);
+      const glm::vec2 region(region_size_);
+      shader.set_vec2("uvScale", region / source);
+      shader.set_vec2("uvMax", (region - glm::vec2(0.5f)) / source);
+      shader.set_vec2("texelSize", glm::vec2(1.0f) / source);
+      shader.set_float("sharpenStrength", sharpen_strength_);
+      uniforms_dirty_ = false;
+      last_program_ = shader.ID;
+    }
+
+    glActiveTexture(GL_TEXTURE0 + LUT_UNIT);
+    glBindTexture(GL_TEXTURE_3D, palette_lut_);
+    glActiveTexture(GL_TEXTURE0 + DITHER_UNIT);
+    glBindTexture(GL_TEXTURE_2D, dither_texture_);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, source_texture);
+
+    ScreenQuad::draw();
+  }
+
+  // ---- Setters ----
+  void PostProcess::set_effects(const std::uint32_t effects) {
+    if (effects == effects_) return;
+    effects_ = effects;
+    shaders_.request(effects_);
+    ShaderLibrary::get_instance().compile_all();
+    uniforms_dirty_ = true;
+  }
+
+  void PostProcess::prewarm(const std::uint32_t effects) {
+    shaders_.request(effects);
+    ShaderLibrary::get_instance().compile_all();
+  }
+
+  void PostProcess::set_quantize(const int color_levels, const float intensity) {
+    if (color_levels == color_levels_ && intensity == quantize_intensity_) return;
+    color_levels_ = color_levels;
+    quantize_intensity_ = intensity;
+    lut_dirty_ = true;
+    uniforms_dirty_ = true;
+  }
+
+  void PostProcess::set_dither(const float intensity) {
+    if (intensity == dither_intensity_) return;
+    dither_intensity_ = intensity;
+    uniforms_dirty_ = true;
+  }
+
+  void PostProcess::set_sharpen(const float strength) {
+    if (strength == sharpen_strength_) return;
+    sharpen_strength_ = strength;
+    uniforms_dirty_ = true;
+  }
+
+  void PostProcess::set_source_region(const glm::ivec2 &source_size, const glm::ivec2 &region_size) {
+    if (source_size.x == source_size_.x && source_size.y == source_size_.y &&
+        region_size.x == region_size_.x && region_size.y == region_size_.y) return;
+    source_size_ = glm::max(source_size, glm::ivec2(1, 1));
+    region_size_ = glm::max(region_size, glm::ivec2(1, 1));
+    uniforms_dirty_ = true;
+  }
+} // STARBORN
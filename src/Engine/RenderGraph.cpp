@@ -0,0 +1,190 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "RenderGraph.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace STARBORN {
+  // ---- Builder ----
+  RenderGraph::TextureHandle RenderGraph::Builder::create(const std::string &name, const RenderTargetDesc &desc) {
+    Texture texture;
+    texture.name = name;
+    texture.desc = desc;
+    graph_.textures_.push_back(std::move(texture));
+    return write(TextureHandle{static_cast<int>(graph_.textures_.size()) - 1});
+  }
+
+  RenderGraph::TextureHandle RenderGraph::Builder::read(const TextureHandle texture) {
+    if (!texture.is_valid()) throw std::runtime_error("RenderGraph: invalid texture read in " + graph_.passes_[pass_].name);
+    graph_.passes_[pass_].reads.push_back(texture.index);
+    return texture;
+  }
+
+  RenderGraph::TextureHandle RenderGraph::Builder::write(const TextureHandle texture) {
+    if (!texture.is_valid()) throw std::runtime_error("RenderGraph: invalid texture write in " + graph_.passes_[pass_].name);
+    graph_.passes_[pass_].writes.push_back(texture.index);
+    graph_.textures_[texture.index].writers.push_back(pass_);
+    return texture;
+  }
+
+  void RenderGraph::Builder::side_effect() {
+    graph_.passes_[pass_].side_effect = true;
+  }
+
+  // ---- Resources ----
+  void RenderGraph::Resources::bind(const TextureHandle texture) const {
+    const auto &entry = graph_.textures_[texture.index];
+    if (entry.frame_buffer) entry.frame_buffer->bind();
+    else glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, entry.desc.width, entry.desc.height);
+  }
+
+  FrameBuffer* RenderGraph::Resources::get_frame_buffer(const TextureHandle texture) const {
+    return graph_.textures_[texture.index].frame_buffer;
+  }
+
+  unsigned int RenderGraph::Resources::get_texture_id(const TextureHandle texture) const {
+    const auto *frame_buffer = get_frame_buffer(texture);
+    return frame_buffer ? frame_buffer->get_texture_id() : 0;
+  }
+
+  // ---- Building ----
+  RenderGraph::TextureHandle RenderGraph::import_target(const std::string &name, FrameBuffer *frame_buffer,
+                                                        const RenderTargetDesc &desc) {
+    Texture texture;
+    texture.name = name;
+    texture.desc = desc;
+    texture.imported = true;
+    texture.frame_buffer = frame_buffer;
+    textures_.push_back(std::move(texture));
+    return TextureHandle{static_cast<int>(textures_.size()) - 1};
+  }
+
+  void RenderGraph::add_pass(const std::string &name, const SetupFunction &setup, ExecuteFunction execute) {
+    Pass pass;
+    pass.name = name;
+    pass.execute = std::move(execute);
+    passes_.push_back(std::move(pass));
+
+    Builder builder(*this, static_cast<int>(passes_.size()) - 1);
+    setup(builder);
+    compiled_ = false;
+  }
+
+  // ---- Frame ----
+  void RenderGraph::use(const int texture, const int pass) {
+    auto &entry = textures_[texture];
+    if (entry.first_use < 0) entry.first_use = pass;
+    entry.last_use = std::max(entry.last_use, pass);
+  }
+
+  void RenderGraph::compile() {
+    // ---- Reference Counts: A Pass Is Needed While Anything Reads Its Output ----
+    std::vector<int> readers(textures_.size(), 0);
+    for (auto &pass : passes_) {
+      pass.ref_count = static_cast<int>(pass.writes.size());
+      pass.culled = false;
+      for (const int texture : pass.reads) readers[texture]++;
+    }
+
+    // ---- Imported Targets And Side Effects Are Always Consumed ----
+    for (std::size_t i = 0; i < textures_.size(); i++) {
+      if (textures_[i].imported) readers[i]++;
+    }
+    for (auto &pass : passes_) {
+      if (pass.side_effect) pass.ref_count++;
+    }
+
+    // ---- Cull: Flood From Unread Textures Back Through Their Writers ----
+    std::vector<int> unreferenced;
+    const auto cull = [&](Pass &pass) {
+      pass.culled = true;
+      for (const int read : pass.reads) {
+        if (--readers[read] == 0) unreferenced.push_back(read);
+      }
+    };
+
+    for (std::size_t i = 0; i < textures_.size(); i++) {
+      if (readers[i] == 0) unreferenced.push_back(static_cast<int>(i));
+    }
+
+    // ---- Passes Writing Nothing (And Without Side Effects) Are Dead From The Start ----
+    for (auto &pass : passes_) {
+      if (pass.ref_count == 0) cull(pass);
+    }
+
+    while (!unreferenced.empty()) {
+      const int texture = unreferenced.back();
+      unreferenced.pop_back();
+
+      for (const int writer : textures_[texture].writers) {
+        auto &pass = passes_[writer];
+        if (--pass.ref_count > 0 || pass.culled) continue;
+        cull(pass);
+      }
+    }
+
+    // ---- Lifetimes Over Surviving Passes ----
+    for (auto &texture : textures_) {
+      texture.first_use = -1;
+      texture.last_use = -1;
+      texture.last_write = -1;
+    }
+    for (int i = 0; i < static_cast<int>(passes_.size()); i++) {
+      if (passes_[i].culled) continue;
+      for (const int texture : passes_[i].reads) use(texture, i);
+      for (const int texture : passes_[i].writes) {
+        use(texture, i);
+        textures_[texture].last_write = i;
+      }
+    }
+
+    compiled_ = true;
+  }
+
+  void RenderGraph::execute(RenderTargetPool &pool) {
+    if (!compiled_) compile();
+
+    const Resources resources(*this);
+    for (int i = 0; i < static_cast<int>(passes_.size()); i++) {
+      auto &pass = passes_[i];
+      if (pass.culled) continue;
+
+      // ---- Materialize Transients First Used Here ----
+      for (auto &texture : textures_) {
+        if (!texture.imported && texture.first_use == i) texture.frame_buffer = pool.acquire(texture.desc);
+      }
+
+      pass.execute(resources);
+
+      // ---- Resolve Written Targets, Drop What No Later Pass Renders Into ----
+      for (const int written : pass.writes) {
+        const auto &texture = textures_[written];
+        if (texture.frame_buffer) texture.frame_buffer->end_pass(texture.last_write > i);
+      }
+
+      // ---- Return Transients Whose Lifetime Ends Here, Later Passes May Alias Them ----
+      for (auto &texture : textures_) {
+        if (!texture.imported && texture.last_use == i) {
+          pool.release(texture.frame_buffer);
+          texture.frame_buffer = nullptr;
+        }
+      }
+    }
+
+    pool.end_frame();
+  }
+
+  void RenderGraph::reset() {
+    textures_.clear();
+    passes_.clear();
+    compiled_ = false;
+  }
+
+  // ---- Getters ----
+  std::size_t RenderGraph::get_culled_count() const {
+    return static_cast<std::size_t>(std::ranges::count_if(passes_, [](const Pass &pass) { return pass.culled; }));
+  }
+} // STARBORN
@@ -0,0 +1,58 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "RenderSettings.hpp"
+#include <json.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace STARBORN {
+  // ---- Loading ----
+  RenderSettings RenderSettings::load(const std::string &path) {
+    RenderSettings settings;
+
+    std::ifstream file(path);
+    if (!file) {
+      std::cout << "RENDER_SETTINGS::NOT_FOUND " << path << ". USING DEFAULTS" << std::endl;
+      return settings;
+    }
+
+    try {
+      const auto json = nlohmann::json::parse(file);
+      settings.msaa_samples = std::clamp(json.value("msaa_samples", settings.msaa_samples), 1, 16);
+      settings.hdr = json.value("hdr", settings.hdr);
+      settings.reverse_z = json.value("reverse_z", settings.reverse_z);
+      settings.present_mode = json.value("present_mode", settings.present_mode);
+      settings.frame_rate_cap = json.value("frame_rate_cap", settings.frame_rate_cap);
+      settings.max_frames_in_flight = std::clamp(json.value("max_frames_in_flight", settings.max_frames_in_flight), 1, 4);
+      settings.tick_rate = std::clamp(json.value("tick_rate", settings.tick_rate), 1.0, 1000.0);
+      settings.max_catch_up_steps = std::clamp(json.value("max_catch_up_steps", settings.max_catch_up_steps), 1, 32);
+      settings.render_thread = json.value("render_thread", settings.render_thread);
+      settings.shader_hot_reload = json.value("shader_hot_reload", settings.shader_hot_reload);
+    } catch (const nlohmann::json::exception &e) {
+      std::cerr << "ERROR::RENDER_SETTINGS::PARSE_FAILED " << path << "\n" << e.what() << std::endl;
+    }
+
+    return settings;
+  }
+
+  // ---- Derived ----
+  FrameBufferDesc RenderSettings::scene_target() const {
+    FrameBufferDesc desc;
+    desc.color_formats = {hdr ? static_cast<GLenum>(GL_RGBA16F) : static_cast<GLenum>(GL_RGB8)};
+    // ---- Reverse-Z Only Pays Off With Float Depth; Nothing Uses Stencil ----
+    desc.depth_format = reverse_z ? static_cast<GLenum>(GL_DEPTH_COMPONENT32F) : static_cast<GLenum>(GL_DEPTH24_STENCIL8);
+    desc.samples = msaa_samples;
+    return desc;
+  }
+
+  FramePacer::Config RenderSettings::frame_pacing() const {
+    FramePacer::Config config;
+    config.mode = FramePacer::parse_mode(present_mode);
+    config.frame_rate = frame_rate_cap;
+    config.max_frames_in_flight = max_frames_in_flight;
+    return config;
+  }
+} // STARBORN
@@ -0,0 +1,61 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "RenderTargetPool.hpp"
+#include <algorithm>
+
+namespace STARBORN {
+  // ---- Allocation ----
+  FrameBuffer* RenderTargetPool::acquire(const RenderTargetDesc &desc) {
+    for (auto &slot : slots_) {
+      if (!slot.in_use && slot.desc == desc) {
+        slot.in_use = true;
+        slot.idle_frames = 0;
+        return slot.frame_buffer.get();
+      }
+    }
+
+    Slot slot;
+    slot.frame_buffer = std::make_unique<FrameBuffer>(desc.width, desc.height, desc.format);
+    slot.desc = desc;
+    slot.in_use = true;
+    slots_.push_back(std::move(slot));
+    return slots_.back().frame_buffer.get();
+  }
+
+  void RenderTargetPool::release(const FrameBuffer *frame_buffer) {
+    for (auto &slot : slots_) {
+      if (slot.frame_buffer.get() == frame_buffer) {
+        slot.in_use = false;
+        return;
+      }
+    }
+  }
+
+  // ---- Maintenance ----
+  void RenderTargetPool::end_frame() {
+    for (auto &slot : slots_) {
+      if (slot.in_use) slot.idle_frames = 0;
+      else slot.idle_frames++;
+    }
+
+    std::erase_if(slots_, [](const Slot &slot) {
+      return !slot.in_use && slot.idle_frames > MAX_IDLE_FRAMES;
+    });
+  }
+
+  void RenderTargetPool::resize(const int old_width, const int old_height, const int width, const int height) {
+    for (auto &slot : slots_) {
+      if (slot.in_use || slot.desc.width != old_width || slot.desc.height != old_height) continue;
+
+      slot.frame_buffer->resize(width, height);
+      slot.desc.width = width;
+      slot.desc.height = height;
+    }
+  }
+
+  void RenderTargetPool::clear() {
+    slots_.clear();
+  }
+} // STARBORN
@@ -0,0 +1,119 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "RenderThread.hpp"
+#include <future>
+#include <iostream>
+#include <memory>
+
+namespace STARBORN {
+  // ---- Constructor & Destructor ----
+  RenderThread::~RenderThread() { stop(); }
+
+  // ---- Lifecycle ----
+  void RenderThread::start(GLFWwindow *window, FrameCallback render_frame, const bool threaded) {
+    window_ = window;
+    render_frame_ = std::move(render_frame);
+    threaded_ = threaded;
+    if (!threaded_) return;
+
+    // ---- A Context Can Only Be Current On One Thread ----
+    glfwMakeContextCurrent(nullptr);
+    stopping_ = false;
+    thread_ = std::thread(&RenderThread::run, this);
+    render_thread_id_ = thread_.get_id();
+  }
+
+  void RenderThread::stop() {
+    if (!thread_.joinable()) return;
+
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    glfwMakeContextCurrent(window_);
+    threaded_ = false;
+  }
+
+  // ---- Submission ----
+  void RenderThread::submit(FramePacket &packet) {
+    if (!threaded_) {
+      render_frame_(packet);
+      return;
+    }
+
+    {
+      std::unique_lock lock(mutex_);
+      consumed_.wait(lock, [this] { return !packet_ready_ || error_; });
+      rethrow_error();
+
+      std::swap(pending_, packet);
+      packet_ready_ = true;
+    }
+    wake_.notify_one();
+  }
+
+  void RenderThread::execute(Command command) {
+    if (!threaded_ || std::this_thread::get_id() == render_thread_id_) {
+      command();
+      return;
+    }
+
+    // ---- packaged_task Carries Exceptions Back To The Caller ----
+    auto task = std::make_shared<std::packaged_task<void()>>(std::move(command));
+    auto done = task->get_future();
+    {
+      std::lock_guard lock(mutex_);
+      rethrow_error();
+      commands_.emplace_back([task] { (*task)(); });
+    }
+    wake_.notify_one();
+    done.get();
+  }
+
+  void RenderThread::rethrow_error() {
+    if (!error_) return;
+    std::rethrow_exception(error_);
+  }
+
+  // ---- Render Thread ----
+  void RenderThread::run() {
+    glfwMakeContextCurrent(window_);
+
+    while (true) {
+      bool has_frame = false;
+      {
+        std::unique_lock lock(mutex_);
+        wake_.wait(lock, [this] { return stopping_ || packet_ready_ || !commands_.empty(); });
+
+        running_commands_.swap(commands_);
+        if (packet_ready_) {
+          // ---- Previous current_ Goes Back To The Simulation For Reuse ----
+          std::swap(current_, pending_);
+          packet_ready_ = false;
+          has_frame = !error_;
+        } else if (stopping_ && running_commands_.empty()) break;
+      }
+      consumed_.notify_one();
+
+      // ---- Commands Were Queued Before This Packet, So They Run First ----
+      for (auto &command : running_commands_) command();
+      running_commands_.clear();
+
+      if (!has_frame) continue;
+      try {
+        render_frame_(current_);
+      } catch (const std::exception &e) {
+        std::cerr << "ERROR::RENDER_THREAD::FRAME_FAILED\n" << e.what() << std::endl;
+        std::lock_guard lock(mutex_);
+        error_ = std::current_exception();
+      }
+    }
+
+    glfwMakeContextCurrent(nullptr);
+  }
+} // STARBORN
@@ -3,6 +3,7 @@
 */
 
 #include "SceneManager.hpp"
+#include "PhysicsWorld.hpp"
 
 namespace STARBORN {
   SceneManager *SceneManager::instance_ = nullptr;
@@ -36,7 +37,7 @@ namespace STARBORN {
         transitioning_ = true;
       } else {
         active_scene_ = it->second.get();
-        active_scene_->init();
+        run_on_render_thread([this] { active_scene_->init(); });
         active_scene_->on_enter();
       }
     } else throw std::runtime_error("Scene not found: " + name);
@@ -47,24 +48,45 @@ namespace STARBORN {
     if (transitioning_) {
       active_scene_ = next_scene_;
       next_scene_ = nullptr;
-      active_scene_->init();
+      run_on_render_thread([this] { active_scene_->init(); });
       active_scene_->on_enter();
       transitioning_ = false;
     }
 
-    if (active_scene_) active_scene_->update(delta_time);
+    if (!active_scene_) return;
+
+    // ---- Physics First, So Scene Logic Sees This Tick's Contacts ----
+    if (PhysicsWorld *physics = active_scene_->get_physics()) physics->step(delta_time);
+    active_scene_->update(delta_time);
+  }
+
+  void SceneManager::extract(FramePacket &packet, const float alpha) const {
+    packet.scene = active_scene_;
+    if (active_scene_) active_scene_->extract(packet, alpha);
+  }
+
+  void SceneManager::render(const FramePacket &packet) {
+    // ---- The Packet Remembers Its Scene; active_scene_ May Have Moved On ----
+    if (packet.scene) packet.scene->render(packet);
   }
 
-  void SceneManager::render() const {
-    if (active_scene_) active_scene_->render();
+  void SceneManager::resize(const int width, const int height) const {
+    if (active_scene_) active_scene_->on_resize(width, height);
   }
 
   void SceneManager::cleanup() {
-    for (auto &scene_pair : scenes_) {
-      scene_pair.second->cleanup();
-    }
-    scenes_.clear();
+    run_on_render_thread([this] {
+      for (auto &scene_pair : scenes_) {
+        scene_pair.second->cleanup();
+      }
+      scenes_.clear();
+    });
     active_scene_ = nullptr;
     next_scene_ = nullptr;
   }
+
+  void SceneManager::run_on_render_thread(const RenderThread::Command &command) const {
+    if (render_thread_) render_thread_->execute(command);
+    else command();
+  }
 }
\ No newline at end of file
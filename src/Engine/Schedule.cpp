@@ -0,0 +1,68 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "Schedule.hpp"
+
+namespace STARBORN {
+  // ---- Systems ----
+  void Schedule::add(std::string name, const ComponentMask reads, const ComponentMask writes, System system) {
+    systems_.push_back({std::move(name), reads, writes, std::move(system)});
+    dirty_ = true;
+  }
+
+  void Schedule::clear() {
+    systems_.clear();
+    batches_.clear();
+    dirty_ = false;
+  }
+
+  void Schedule::run(World &world, const float delta_time) {
+    if (dirty_) build_batches();
+
+    for (const auto &batch : batches_) {
+      if (batch.size() == 1) {
+        systems_[batch.front()].system(world, delta_time);
+        continue;
+      }
+      JobSystem::get_instance().parallel_for(batch.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) systems_[batch[i]].system(world, delta_time);
+      });
+    }
+  }
+
+  std::size_t Schedule::get_batch_count() {
+    if (dirty_) build_batches();
+    return batches_.size();
+  }
+
+  // ---- Private ----
+  void Schedule::build_batches() {
+    batches_.clear();
+
+    // ---- Each System Lands Right After The Last Batch It Conflicts With ----
+    for (std::size_t i = 0; i < systems_.size(); i++) {
+      std::size_t target = 0;
+      for (std::size_t b = batches_.size(); b > 0; b--) {
+        bool blocked = false;
+        for (const std::size_t other : batches_[b - 1]) {
+          if (conflicts(systems_[i], systems_[other])) {
+            blocked = true;
+            break;
+          }
+        }
+        if (blocked) {
+          target = b;
+          break;
+        }
+      }
+      if (target == batches_.size()) batches_.emplace_back();
+      batches_[target].push_back(i);
+    }
+    dirty_ = false;
+  }
+
+  bool Schedule::conflicts(const Entry &a, const Entry &b) {
+    return (a.writes & (b.reads | b.writes)) != 0 || (b.writes & a.reads) != 0;
+  }
+} // STARBORN
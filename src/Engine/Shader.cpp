@@ -3,14 +3,52 @@
 */
 
 #include "Shader.hpp"
+#include "ShaderCache.hpp"
+#include "GLExtensions.hpp"
+#include "ShaderPreprocessor.hpp"
 
 namespace STARBORN {
 
   // ---- Constructor & Destructor ----
-  Shader::Shader(const char *vertex_path, const char *fragment_path) {
+  Shader::Shader(const char *vertex_path, const char *fragment_path, const bool deferred)
+    : vertex_path_(vertex_path), fragment_path_(fragment_path) {
+    if (deferred) return;
+
+    submit();
+    finalize();
+  }
+
+  Shader::Shader(const char *vertex_path, const char *fragment_path,
+                 const std::vector<std::string> &defines, const bool deferred)
+    : vertex_path_(vertex_path), fragment_path_(fragment_path), defines_(defines) {
+    if (deferred) return;
+
+    submit();
+    finalize();
+  }
+
+  Shader::~Shader() {
+    // ---- Delete Pending Stages ----
+    if (pending_vertex_) glDeleteShader(pending_vertex_);
+    if (pending_fragment_) glDeleteShader(pending_fragment_);
+
+    // ---- Delete Shader Program ----
+    glDeleteProgram(ID);
+  }
+
+  // ---- Build ----
+  void Shader::submit() {
+    if (submitted_) return;
+    submitted_ = true;
+    dependencies_.clear();
+
     // ---- Retrieve Vertex & Fragment Source Code ----
-    std::string vertex_code = read_shader_file(vertex_path);
-    std::string fragment_code = read_shader_file(fragment_path);
+    std::string vertex_code = read_shader_file(vertex_path_.c_str());
+    std::string fragment_code = read_shader_file(fragment_path_.c_str());
+
+    if (!source_fallback_ && (vertex_code == SHADER_FAIL || fragment_code == SHADER_FAIL)) {
+      throw std::runtime_error("ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ");
+    }
 
     // ---- Fallback Shaders ----
     if (vertex_code == SHADER_FAIL) {
@@ -27,84 +65,122 @@ namespace STARBORN {
       }
     }
 
+    // ---- Program Binary Cache ----
+    const auto &cache = ShaderCache::get_instance();
+    // Feedback varyings are link state, so they belong in the key.
+    std::string link_state = ShaderPreprocessor::define_block(defines_);
+    for (const auto &varying : feedback_varyings_) link_state += "// feedback " + varying + "\n";
+    cache_key_ = cache.make_key(vertex_code, fragment_code, link_state);
+
+    ID = glCreateProgram();
+    if (cache.load(cache_key_, ID)) {
+      ready_ = true;
+      return;
+    }
+    glDeleteProgram(ID);
+
     const char* vshader = vertex_code.c_str();
     const char* fshader = fragment_code.c_str();
 
     // ---- Compile Shaders ----
-    const unsigned int vertex = compile_shader(vshader, GL_VERTEX_SHADER);
-    const unsigned int fragment = compile_shader(fshader, GL_FRAGMENT_SHADER);
+    pending_vertex_ = compile_shader(vshader, GL_VERTEX_SHADER);
+    pending_fragment_ = compile_shader(fshader, GL_FRAGMENT_SHADER);
 
     // ---- Shader Program ----
-    create_shader_program(vertex, fragment);
+    create_shader_program(pending_vertex_, pending_fragment_);
   }
 
-  Shader::~Shader() {
-    // ---- Delete Shader Program ----
-    glDeleteProgram(ID);
+  bool Shader::is_ready() const {
+    if (ready_) return true;
+    if (!submitted_) return false;
+    if (!GLExtensions::has_parallel_shader_compile()) return true;
+
+    int complete = GL_FALSE;
+    glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete == GL_TRUE;
   }
 
-  std::string Shader::read_shader_file(const char *file_path) const {
-      std::string file_contents;
-      std::ifstream shader_file;
+  void Shader::finalize() {
+    if (ready_) return;
+    if (!submitted_) submit();
+    if (ready_) return;
 
-      shader_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    int success;
+    glGetProgramiv(ID, GL_LINK_STATUS, &success);
+    if (!success) {
+      // ---- Report The Stage That Failed Before The Link Log ----
+      check_shader(pending_vertex_, "VERTEX");
+      check_shader(pending_fragment_, "FRAGMENT");
 
-      try {
-        shader_file.open(file_path);
-        std::stringstream shader_stream;
+      char info_log[512];
+      glGetProgramInfoLog(ID, 512, nullptr, info_log);
+      throw std::runtime_error(info_log);
+    }
 
-        // ---- Read File's Buffer Contents ----
-        shader_stream << shader_file.rdbuf();
+    glDetachShader(ID, pending_vertex_);
+    glDetachShader(ID, pending_fragment_);
+    glDeleteShader(pending_vertex_);
+    glDeleteShader(pending_fragment_);
+    pending_vertex_ = 0;
+    pending_fragment_ = 0;
 
-        // ---- Close File Handles ----
-        shader_file.close();
+    ShaderCache::get_instance().store(cache_key_, ID);
+    ready_ = true;
+  }
 
-        // ---- Convert Stream Into String ----
-        file_contents = shader_stream.str();
-      } catch (std::ifstream::failure &e) {
-        std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ. USING FALLBACK" << std::endl;
-        return SHADER_FAIL;
-      }
+  // ---- Hot Reload ----
+  void Shader::swap_program(Shader &other) {
+    std::swap(ID, other.ID);
+    std::swap(dependencies_, other.dependencies_);
+    std::swap(cache_key_, other.cache_key_);
+    std::swap(ready_, other.ready_);
+  }
 
-      return file_contents;
+  std::string Shader::read_shader_file(const char *file_path) {
+    // ---- Resolve #include And Inject Defines ----
+    auto source = ShaderPreprocessor::process(file_path, defines_);
+    if (source.code.empty()) {
+      std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ. USING FALLBACK" << std::endl;
+      return SHADER_FAIL;
     }
 
+    dependencies_.insert(dependencies_.end(), source.dependencies.begin(), source.dependencies.end());
+    return source.code;
+  }
+
   unsigned int Shader::compile_shader(const char *shader_code,
                                       const GLenum shader_type) {
-    int success;
-
     const unsigned int shader = glCreateShader(shader_type);
     glShaderSource(shader, 1, &shader_code, nullptr);
     glCompileShader(shader);
 
+    // ---- Status Is Queried In finalize() So The Driver Can Keep Compiling ----
+    return shader;
+  }
+
+  void Shader::check_shader(const unsigned int shader, const char *stage) {
+    int success;
+
     // ----- Compile Errors ----
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success) {
       char info_log[512];
       glGetShaderInfoLog(shader, 512, nullptr, info_log);
-      throw std::runtime_error(info_log);
+      throw std::runtime_error(std::string("ERROR::SHADER::") + stage + "::COMPILATION_FAILED\n" + info_log);
     }
-
-    return shader;
   }
 
   void Shader::create_shader_program(const unsigned int vertex,
                                      const unsigned int fragment) {
-    int success;
-
     ID = glCreateProgram();
+    ShaderCache::get_instance().prepare(ID);
     glAttachShader(ID, vertex);
     glAttachShader(ID, fragment);
-    glLinkProgram(ID);
-
-    glGetProgramiv(ID, GL_LINK_STATUS, &success);
-    if (!success) {
-      char info_log[512];
-      glGetProgramInfoLog(ID, 512, nullptr, info_log);
-      throw std::runtime_error(info_log);
+    if (!feedback_varyings_.empty()) {
+      std::vector<const char *> names;
+      for (const auto &varying : feedback_varyings_) names.push_back(varying.c_str());
+      glTransformFeedbackVaryings(ID, static_cast<GLsizei>(names.size()), names.data(), GL_INTERLEAVED_ATTRIBS);
     }
-
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
+    glLinkProgram(ID);
   }
-} // STARBORN
\ No newline at end of file
+} // STARBORN
@@ -0,0 +1,146 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "ShaderCache.hpp"
+#include "GLExtensions.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace STARBORN {
+  namespace {
+    constexpr std::uint32_t CACHE_MAGIC = 0x42505353; // "SSPB"
+    constexpr std::uint32_t CACHE_VERSION = 1;
+
+    struct CacheHeader {
+      std::uint32_t magic;
+      std::uint32_t version;
+      std::uint64_t key;
+      std::uint32_t format;
+      std::uint32_t length;
+    };
+
+    // ---- FNV-1a ----
+    std::uint64_t hash_bytes(std::uint64_t hash, const std::string &data) {
+      for (const unsigned char c : data) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+      }
+      // ---- Separator So "ab"+"c" And "a"+"bc" Differ ----
+      hash ^= 0xff;
+      hash *= 0x100000001b3ULL;
+      return hash;
+    }
+
+    std::string gl_string(const GLenum name) {
+      const auto *value = reinterpret_cast<const char *>(glGetString(name));
+      return value ? value : "";
+    }
+  }
+
+  // ---- Initialization ----
+  void ShaderCache::init() {
+    initialized_ = true;
+    supported_ = GLExtensions::has_program_binary();
+    driver_id_ = gl_string(GL_VENDOR) + '|' + gl_string(GL_RENDERER) + '|' + gl_string(GL_VERSION);
+
+    if (!supported_) std::cout << "SHADER_CACHE::PROGRAM_BINARY_UNSUPPORTED. COMPILING FROM SOURCE" << std::endl;
+  }
+
+  std::filesystem::path ShaderCache::path_for(const std::uint64_t key) const {
+    std::stringstream name;
+    name << std::hex << key << ".bin";
+    return directory_ / name.str();
+  }
+
+  // ---- Keys ----
+  std::uint64_t ShaderCache::make_key(const std::string &vertex_code, const std::string &fragment_code,
+                                      const std::string &defines) const {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hash_bytes(hash, driver_id_);
+    hash = hash_bytes(hash, defines);
+    hash = hash_bytes(hash, vertex_code);
+    hash = hash_bytes(hash, fragment_code);
+    return hash;
+  }
+
+  // ---- Program Binaries ----
+  void ShaderCache::prepare(const unsigned int program) const {
+    if (supported_) GLExtensions::program_parameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+
+  bool ShaderCache::load(const std::uint64_t key, const unsigned int program) const {
+    if (!supported_) return false;
+
+    const auto path = path_for(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    CacheHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    std::vector<char> binary;
+    if (file && header.magic == CACHE_MAGIC && header.version == CACHE_VERSION && header.key == key) {
+      binary.resize(header.length);
+      file.read(binary.data(), header.length);
+    }
+    file.close();
+
+    // ---- Invalidate Truncated Or Foreign Entries ----
+    if (binary.empty() || static_cast<std::uint32_t>(binary.size()) != header.length) {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+      return false;
+    }
+
+    GLExtensions::program_binary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    // ---- Driver Rejected The Binary, Fall Back To Source ----
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+      return false;
+    }
+
+    return true;
+  }
+
+  void ShaderCache::store(const std::uint64_t key, const unsigned int program) const {
+    if (!supported_) return;
+
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLExtensions::get_program_binary(program, length, &length, &format, binary.data());
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+      std::cerr << "ERROR::SHADER_CACHE::CANNOT_CREATE_DIRECTORY " << directory_ << std::endl;
+      return;
+    }
+
+    // ---- Write To A Temporary File Then Rename So Readers Never See Partial Entries ----
+    const auto path = path_for(key);
+    auto temp_path = path;
+    temp_path += ".tmp";
+
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    const CacheHeader header{CACHE_MAGIC, CACHE_VERSION, key, format, static_cast<std::uint32_t>(length)};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(binary.data(), length);
+    file.close();
+
+    if (!file) {
+      std::filesystem::remove(temp_path, ec);
+      return;
+    }
+    std::filesystem::rename(temp_path, path, ec);
+  }
+} // STARBORN
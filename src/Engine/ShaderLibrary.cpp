@@ -0,0 +1,193 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "ShaderLibrary.hpp"
+#include "GLExtensions.hpp"
+#include <algorithm>
+
+namespace STARBORN {
+  // ---- Requests ----
+  void ShaderLibrary::request(const std::string &name, const char *vertex_path,
+                              const char *fragment_path, const std::string &fallback,
+                              const std::vector<std::string> &defines) {
+    if (entries_.contains(name)) return;
+
+    Entry entry;
+    entry.shader = std::make_unique<Shader>(vertex_path, fragment_path, defines, true);
+    entry.fallback = fallback;
+    entries_[name] = std::move(entry);
+    queued_.push_back(name);
+  }
+
+  void ShaderLibrary::compile_all() {
+    // ---- Let The Driver Pick Its Own Thread Count ----
+    if (GLExtensions::max_shader_compiler_threads) GLExtensions::max_shader_compiler_threads(0xFFFFFFFF);
+
+    for (const auto &name : queued_) {
+      entries_[name].shader->submit();
+      pending_.push_back(name);
+    }
+    queued_.clear();
+  }
+
+  // ---- Completion ----
+  void ShaderLibrary::finalize_entry(const std::string &name, Entry &entry) {
+    try {
+      entry.shader->finalize();
+    } catch (const std::runtime_error &e) {
+      std::cerr << "ERROR::SHADER_LIBRARY::" << name << "\n" << e.what() << std::endl;
+      entry.failed = true;
+    }
+
+    if (watcher_) watch_entry(entry);
+  }
+
+  void ShaderLibrary::poll() {
+    if (watcher_) {
+      start_reloads();
+      poll_reloads();
+    }
+
+    if (pending_.empty()) return;
+
+    // ---- Without The Extension Every Status Query Blocks, So Spread Them Over Frames ----
+    const bool parallel = GLExtensions::has_parallel_shader_compile();
+    bool finalized_one = false;
+
+    std::erase_if(pending_, [&](const std::string &name) {
+      if (!parallel && finalized_one) return false;
+
+      auto &entry = entries_[name];
+      if (!entry.shader->is_ready()) return false;
+
+      finalize_entry(name, entry);
+      finalized_one = true;
+      return true;
+    });
+  }
+
+  void ShaderLibrary::finish(const std::string &name) {
+    const auto it = entries_.find(name);
+    if (it == entries_.end()) throw std::runtime_error("Shader not found: " + name);
+
+    // ---- Submit Out Of Order If The Batch Has Not Been Compiled Yet ----
+    std::erase(queued_, name);
+    std::erase(pending_, name);
+    finalize_entry(name, it->second);
+  }
+
+  void ShaderLibrary::finish_all() {
+    compile_all();
+    for (const auto &name : pending_) finalize_entry(name, entries_[name]);
+    pending_.clear();
+  }
+
+  // ---- Hot Reload ----
+  void ShaderLibrary::set_hot_reload(const bool enabled) {
+    if (!enabled) {
+      watcher_.reset();
+      for (auto &[name, entry] : entries_) {
+        entry.staging.reset();
+        entry.watched = false;
+      }
+      return;
+    }
+
+    if (watcher_) return;
+    watcher_ = std::make_unique<FileWatcher>();
+    for (auto &[name, entry] : entries_) {
+      if (entry.shader->is_finalized() || entry.failed) watch_entry(entry);
+    }
+  }
+
+  void ShaderLibrary::watch_entry(Entry &entry) {
+    if (entry.watched) return;
+    entry.watched = true;
+
+    for (const auto &file : entry.shader->get_dependencies()) watcher_->watch(file);
+  }
+
+  void ShaderLibrary::start_reloads() {
+    const auto changed = watcher_->poll();
+    if (changed.empty()) return;
+
+    for (auto &[name, entry] : entries_) {
+      if (entry.staging || !entry.watched) continue;
+
+      const auto &dependencies = entry.shader->get_dependencies();
+      const bool affected = std::ranges::any_of(changed, [&](const std::string &file) {
+        return std::ranges::find(dependencies, file) != dependencies.end();
+      });
+      if (!affected) continue;
+
+      // ---- Rebuild Beside The Live Program, Never In Place ----
+      const auto &shader = *entry.shader;
+      entry.staging = std::make_unique<Shader>(shader.get_vertex_path().c_str(), shader.get_fragment_path().c_str(),
+                                               shader.get_defines(), true);
+      entry.staging->set_source_fallback(false);
+
+      // ---- An Unreadable File Is A Failed Reload: Keep The Live Program And Its Watch List ----
+      try {
+        entry.staging->submit();
+      } catch (const std::runtime_error &e) {
+        std::cerr << "ERROR::SHADER_LIBRARY::RELOAD_FAILED::" << name << "\n" << e.what() << std::endl;
+        entry.staging.reset();
+        continue;
+      }
+      std::cout << "SHADER_LIBRARY::RELOADING " << name << std::endl;
+    }
+  }
+
+  void ShaderLibrary::poll_reloads() {
+    for (auto &[name, entry] : entries_) {
+      if (!entry.staging || !entry.staging->is_ready()) continue;
+
+      try {
+        entry.staging->finalize();
+      } catch (const std::runtime_error &e) {
+        std::cerr << "ERROR::SHADER_LIBRARY::RELOAD_FAILED::" << name << "\n" << e.what() << std::endl;
+        entry.staging.reset();
+        continue;
+      }
+
+      // ---- Swap In; Staging Now Holds The Old Program And Deletes It ----
+      entry.shader->swap_program(*entry.staging);
+      entry.staging.reset();
+      entry.failed = false;
+
+      // ---- Pick Up Newly #include'd Files ----
+      for (const auto &file : entry.shader->get_dependencies()) watcher_->watch(file);
+      std::cout << "SHADER_LIBRARY::RELOADED " << name << std::endl;
+    }
+  }
+
+  // ---- Access ----
+  Shader& ShaderLibrary::get(const std::string &name) {
+    const auto it = entries_.find(name);
+    if (it == entries_.end()) throw std::runtime_error("Shader not found: " + name);
+
+    auto &entry = it->second;
+    if (!entry.failed && entry.shader->is_finalized()) return *entry.shader;
+
+    // ---- Still Building Or Broken: Render With The Fallback ----
+    if (!entry.fallback.empty()) return get(entry.fallback);
+
+    finish(name);
+    if (entry.failed) throw std::runtime_error("Shader failed to build: " + name);
+    return *entry.shader;
+  }
+
+  bool ShaderLibrary::is_ready(const std::string &name) const {
+    const auto it = entries_.find(name);
+    return it != entries_.end() && !it->second.failed && it->second.shader->is_finalized();
+  }
+
+  // ---- Cleanup ----
+  void ShaderLibrary::clear() {
+    watcher_.reset();
+    entries_.clear();
+    queued_.clear();
+    pending_.clear();
+  }
+} // STARBORN
@@ -0,0 +1,107 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "ShaderPreprocessor.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace STARBORN {
+  namespace ShaderPreprocessor {
+    namespace {
+      constexpr int MAX_INCLUDE_DEPTH = 16;
+
+      bool read_file(const std::string &path, std::string &contents) {
+        std::ifstream file(path);
+        if (!file) return false;
+
+        std::stringstream stream;
+        stream << file.rdbuf();
+        contents = stream.str();
+        return true;
+      }
+
+      // ---- Parses `#include "file"` Or `#include <file>` ----
+      bool parse_include(const std::string &line, std::string &target) {
+        const auto start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line.compare(start, 8, "#include") != 0) return false;
+
+        const auto open = line.find_first_of("\"<", start + 8);
+        if (open == std::string::npos) return false;
+        const auto close = line.find_first_of("\">", open + 1);
+        if (close == std::string::npos) return false;
+
+        target = line.substr(open + 1, close - open - 1);
+        return true;
+      }
+
+      bool is_version(const std::string &line) {
+        const auto start = line.find_first_not_of(" \t");
+        return start != std::string::npos && line.compare(start, 8, "#version") == 0;
+      }
+
+      void expand(const std::filesystem::path &path, const std::string &defines, Source &source,
+                  const int depth, const bool root) {
+        if (depth > MAX_INCLUDE_DEPTH) {
+          std::cerr << "ERROR::SHADER::PREPROCESSOR::INCLUDE_DEPTH_EXCEEDED " << path << std::endl;
+          return;
+        }
+
+        // ---- Include Once ----
+        const std::string key = path.lexically_normal().generic_string();
+        if (std::ranges::find(source.dependencies, key) != source.dependencies.end()) return;
+
+        std::string contents;
+        if (!read_file(key, contents)) {
+          if (!root) std::cerr << "ERROR::SHADER::PREPROCESSOR::INCLUDE_NOT_FOUND " << key << std::endl;
+          return;
+        }
+        source.dependencies.push_back(key);
+        if (!root) source.code += "#line 1\n";
+
+        std::istringstream stream(contents);
+        std::string line;
+        std::string target;
+        int line_number = 0;
+        bool version_seen = false;
+
+        while (std::getline(stream, line)) {
+          line_number++;
+
+          if (parse_include(line, target)) {
+            expand(path.parent_path() / target, defines, source, depth + 1, false);
+            source.code += "#line " + std::to_string(line_number + 1) + "\n";
+            continue;
+          }
+
+          source.code += line;
+          source.code += '\n';
+
+          // ---- Defines Must Follow #version ----
+          if (root && !version_seen && is_version(line)) {
+            version_seen = true;
+            source.code += defines;
+            source.code += "#line " + std::to_string(line_number + 1) + "\n";
+          }
+        }
+      }
+    }
+
+    Source process(const std::string &path, const std::vector<std::string> &defines) {
+      Source source;
+      expand(path, define_block(defines), source, 0, true);
+      return source;
+    }
+
+    std::string define_block(const std::vector<std::string> &defines) {
+      std::string block;
+      for (const auto &define : defines) {
+        block += "#define " + define + "\n";
+      }
+      return block;
+    }
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "ShaderVariants.hpp"
+#include "ShaderLibrary.hpp"
+#include <functional>
+
+namespace STARBORN {
+  // ---- Constructor ----
+  ShaderVariants::ShaderVariants(std::string name, std::string vertex_path, std::string fragment_path,
+                                 std::vector<std::string> features, std::string fallback)
+    : name_(std::move(name)), vertex_path_(std::move(vertex_path)), fragment_path_(std::move(fragment_path)),
+      features_(std::move(features)), fallback_(std::move(fallback)) {
+    if (features_.size() > 32) throw std::runtime_error("Too many shader features: " + name_);
+  }
+
+  std::string ShaderVariants::variant_name(const std::uint32_t mask) const {
+    return name_ + "#" + std::to_string(mask) + defines_key_;
+  }
+
+  // ---- Variants ----
+  void ShaderVariants::request(const std::uint32_t mask) {
+    auto &library = ShaderLibrary::get_instance();
+    const std::string variant = variant_name(mask);
+    if (library.contains(variant)) return;
+
+    std::vector<std::string> defines = extra_defines_;
+    for (std::size_t i = 0; i < features_.size(); i++) {
+      if (mask & (1u << i)) defines.push_back(features_[i]);
+    }
+
+    library.request(variant, vertex_path_.c_str(), fragment_path_.c_str(), fallback_, defines);
+  }
+
+  Shader& ShaderVariants::get(const std::uint32_t mask) {
+    auto &library = ShaderLibrary::get_instance();
+    const std::string variant = variant_name(mask);
+
+    // ---- A Variant Nobody Requested: Submit Just It, Draw The Fallback Meanwhile ----
+    if (!library.contains(variant)) {
+      request(mask);
+      library.compile_all();
+    }
+    return library.get(variant);
+  }
+
+  bool ShaderVariants::is_ready(const std::uint32_t mask) const {
+    return ShaderLibrary::get_instance().is_ready(variant_name(mask));
+  }
+
+  // ---- Setters ----
+  void ShaderVariants::set_defines(const std::vector<std::string> &defines) {
+    extra_defines_ = defines;
+    if (extra_defines_.empty()) {
+      defines_key_.clear();
+      return;
+    }
+
+    // ---- Programs Built With The Old Defines Stay Under Their Old Names ----
+    std::string joined;
+    for (const auto &define : extra_defines_) joined += define + "\n";
+    defines_key_ = "@" + std::to_string(std::hash<std::string>{}(joined));
+  }
+} // STARBORN
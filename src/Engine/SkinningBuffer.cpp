@@ -0,0 +1,39 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "SkinningBuffer.hpp"
+#include <algorithm>
+
+namespace STARBORN {
+  // ---- Lifecycle ----
+  void SkinningBuffer::init() {
+    if (ubo_ != 0) return;
+    glGenBuffers(1, &ubo_);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+    glBufferData(GL_UNIFORM_BUFFER, MAX_JOINTS * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo_);
+  }
+
+  void SkinningBuffer::cleanup() {
+    if (ubo_ == 0) return;
+    glDeleteBuffers(1, &ubo_);
+    ubo_ = 0;
+  }
+
+  // ---- Upload ----
+  void SkinningBuffer::upload(const std::span<const glm::mat4> palette) const {
+    const std::size_t count = std::min(palette.size(), MAX_JOINTS);
+    if (count == 0) return;
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(count * sizeof(glm::mat4)), palette.data());
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo_);
+  }
+
+  void SkinningBuffer::attach(const GLuint program) {
+    const GLuint block = glGetUniformBlockIndex(program, "Skinning");
+    if (block != GL_INVALID_INDEX) glUniformBlockBinding(program, block, BINDING);
+  }
+} // STARBORN
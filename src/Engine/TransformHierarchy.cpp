@@ -0,0 +1,143 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "TransformHierarchy.hpp"
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define STARBORN_TRANSFORM_SSE 1
+#endif
+
+namespace STARBORN {
+  // ---- Matrix Helpers ----
+  glm::mat4 compose(const Transform &transform) {
+    // ---- T * R * S Without The Two Full Matrix Products ----
+    glm::mat4 matrix = mat4_cast(transform.rotation);
+    matrix[0] *= transform.scale.x;
+    matrix[1] *= transform.scale.y;
+    matrix[2] *= transform.scale.z;
+    matrix[3] = glm::vec4(transform.position, 1.0f);
+    return matrix;
+  }
+
+  void multiply(const glm::mat4 &a, const glm::mat4 &b, glm::mat4 &out) {
+#ifdef STARBORN_TRANSFORM_SSE
+    const float *lhs = &a[0][0];
+    const float *rhs = &b[0][0];
+    float *result = &out[0][0];
+
+    const __m128 a0 = _mm_loadu_ps(lhs);
+    const __m128 a1 = _mm_loadu_ps(lhs + 4);
+    const __m128 a2 = _mm_loadu_ps(lhs + 8);
+    const __m128 a3 = _mm_loadu_ps(lhs + 12);
+
+    // ---- Column j Of The Product Is a * b[j]; Read b[j] Before Writing It ----
+    for (int column = 0; column < 4; column++) {
+      const float *b_column = rhs + column * 4;
+      __m128 sum = _mm_mul_ps(a0, _mm_set1_ps(b_column[0]));
+      sum = _mm_add_ps(sum, _mm_mul_ps(a1, _mm_set1_ps(b_column[1])));
+      sum = _mm_add_ps(sum, _mm_mul_ps(a2, _mm_set1_ps(b_column[2])));
+      sum = _mm_add_ps(sum, _mm_mul_ps(a3, _mm_set1_ps(b_column[3])));
+      _mm_storeu_ps(result + column * 4, sum);
+    }
+#else
+    out = a * b;
+#endif
+  }
+
+  // ---- Nodes ----
+  std::uint32_t TransformHierarchy::add(const std::uint32_t parent, const Transform &local) {
+    const auto node = static_cast<std::uint32_t>(parents_.size());
+    if (parent != NO_PARENT && parent >= node) throw std::runtime_error("TransformHierarchy parent must be added first");
+
+    parents_.push_back(parent);
+    locals_.push_back(local);
+    local_matrices_.emplace_back(1.0f);
+    world_matrices_.emplace_back(1.0f);
+    flags_.push_back(0);
+    mark_dirty(node);
+    return node;
+  }
+
+  void TransformHierarchy::reserve(const std::size_t count) {
+    parents_.reserve(count);
+    locals_.reserve(count);
+    local_matrices_.reserve(count);
+    world_matrices_.reserve(count);
+    flags_.reserve(count);
+  }
+
+  void TransformHierarchy::clear() {
+    parents_.clear();
+    locals_.clear();
+    local_matrices_.clear();
+    world_matrices_.clear();
+    flags_.clear();
+    changed_.clear();
+    first_dirty_ = 0;
+  }
+
+  // ---- Update ----
+  void TransformHierarchy::update() {
+    changed_.clear();
+    const auto count = static_cast<std::uint32_t>(parents_.size());
+    if (first_dirty_ >= count) return;
+
+    // ---- Propagate: A Node Changes If It Or Any Ancestor Did ----
+    for (std::uint32_t node = first_dirty_; node < count; node++) {
+      const std::uint32_t parent = parents_[node];
+      if (parent != NO_PARENT && (flags_[parent] & WORLD_DIRTY)) flags_[node] |= WORLD_DIRTY;
+      if (flags_[node] & (LOCAL_DIRTY | WORLD_DIRTY)) changed_.push_back(node);
+    }
+
+    // ---- Local Matrices Only Depend On Their Own TRS ----
+    JobSystem::get_instance().parallel_for(changed_.size(), 1024, [&](const std::size_t begin, const std::size_t end) {
+      for (std::size_t i = begin; i < end; i++) {
+        const std::uint32_t node = changed_[i];
+        if (flags_[node] & LOCAL_DIRTY) local_matrices_[node] = compose(locals_[node]);
+      }
+    });
+
+    // ---- World Matrices In Order: Parents Are Always Finished First ----
+    for (const std::uint32_t node : changed_) {
+      const std::uint32_t parent = parents_[node];
+      if (parent == NO_PARENT) world_matrices_[node] = local_matrices_[node];
+      else multiply(world_matrices_[parent], local_matrices_[node], world_matrices_[node]);
+    }
+
+    // ---- Flags Are Cleared Last So Children Could Still See Their Parent's ----
+    for (const std::uint32_t node : changed_) flags_[node] = 0;
+    first_dirty_ = count;
+  }
+
+  // ---- Setters ----
+  void TransformHierarchy::set_local(const std::uint32_t node, const Transform &local) {
+    locals_[node] = local;
+    mark_dirty(node);
+  }
+
+  void TransformHierarchy::set_position(const std::uint32_t node, const glm::vec3 &position) {
+    locals_[node].position = position;
+    mark_dirty(node);
+  }
+
+  void TransformHierarchy::set_rotation(const std::uint32_t node, const glm::quat &rotation) {
+    locals_[node].rotation = rotation;
+    mark_dirty(node);
+  }
+
+  void TransformHierarchy::set_scale(const std::uint32_t node, const glm::vec3 &scale) {
+    locals_[node].scale = scale;
+    mark_dirty(node);
+  }
+
+  // ---- Private ----
+  void TransformHierarchy::mark_dirty(const std::uint32_t node) {
+    flags_[node] |= LOCAL_DIRTY | WORLD_DIRTY;
+    first_dirty_ = std::min(first_dirty_, node);
+  }
+} // STARBORN
@@ -3,15 +3,18 @@
 */
 
 #include "Window.hpp"
+#include "GLExtensions.hpp"
 #include <stdexcept>
 
 namespace STARBORN {
   // ---- Constructor & Destructor ----
-  Window::Window(int width, int height, const char *title) : width_(width), height_(height), title_(title) {
+  Window::Window(int width, int height, const char *title)
+    : width_(width), height_(height), title_(title), pending_size_(0) {
     init_GLFW();
     create_window();
     init_GLAD();
     set_viewport();
+    sync_framebuffer_size();
   }
 
   Window::~Window() { glfwDestroyWindow(window_); }
@@ -43,16 +46,56 @@ namespace STARBORN {
       glfwTerminate();
       throw std::runtime_error("Failed to initialize GLAD");
     }
+
+    GLExtensions::load();
   }
 
   // ---- Set Viewport ----
   void Window::set_viewport() const {
+    glfwSetWindowUserPointer(window_, const_cast<Window *>(this));
     glfwSetFramebufferSizeCallback(window_, framebuffer_size_callback);
   }
 
+  void Window::sync_framebuffer_size() {
+    // ---- The Framebuffer Can Differ From The Requested Size (HiDPI) ----
+    int width = width_;
+    int height = height_;
+    glfwGetFramebufferSize(window_, &width, &height);
+    set_pending_size(width, height);
+  }
+
+  void Window::set_pending_size(const int width, const int height) {
+    pending_size_.store(static_cast<std::uint64_t>(static_cast<std::uint32_t>(width)) << 32 |
+                        static_cast<std::uint32_t>(height), std::memory_order_relaxed);
+    resize_pending_.store(true, std::memory_order_release);
+  }
+
+  // ---- Resize ----
+  bool Window::consume_resize() {
+    if (!resize_pending_.exchange(false, std::memory_order_acquire)) return false;
+
+    const std::uint64_t size = pending_size_.load(std::memory_order_relaxed);
+    const auto pending_width = static_cast<std::int32_t>(size >> 32);
+    const auto pending_height = static_cast<std::int32_t>(size & 0xffffffffu);
+
+    // ---- Minimized: Keep The Request Until There Is Something To Draw ----
+    if (pending_width <= 0 || pending_height <= 0) {
+      resize_pending_.store(true, std::memory_order_relaxed);
+      return false;
+    }
+
+    if (pending_width == width_ && pending_height == height_) return false;
+    width_ = pending_width;
+    height_ = pending_height;
+    return true;
+  }
+
   // ---- Callback ----
   void Window::framebuffer_size_callback(GLFWwindow *window, int width, int height) {
-    glViewport(0, 0, width, height);
+    auto *self = static_cast<Window *>(glfwGetWindowUserPointer(window));
+    if (!self) return;
+
+    self->set_pending_size(width, height);
   }
 
 } // STARBORN
\ No newline at end of file
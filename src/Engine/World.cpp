@@ -0,0 +1,166 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+*/
+
+#include "World.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace STARBORN {
+  // ---- Component Types ----
+  std::uint32_t next_component_id() {
+    static std::atomic<std::uint32_t> next{0};
+    const std::uint32_t id = next.fetch_add(1);
+    if (id >= MAX_COMPONENTS) throw std::runtime_error("Too many component types (max 64)");
+    return id;
+  }
+
+  // ---- Archetype ----
+  Archetype::Archetype(const ComponentMask mask, std::vector<ComponentInfo> components)
+    : mask_(mask), components_(std::move(components)) {
+    std::sort(components_.begin(), components_.end(),
+              [](const ComponentInfo &a, const ComponentInfo &b) { return a.id < b.id; });
+    columns_.fill(-1);
+
+    // ---- Largest Row Count Whose Columns (With Alignment Padding) Fit A Chunk ----
+    std::size_t row_bytes = sizeof(Entity);
+    for (const auto &info : components_) row_bytes += info.size;
+    capacity_ = static_cast<std::uint32_t>(CHUNK_BYTES / row_bytes);
+
+    while (capacity_ > 0) {
+      offsets_.clear();
+      std::size_t offset = sizeof(Entity) * capacity_;
+      for (const auto &info : components_) {
+        offset = (offset + info.alignment - 1) / info.alignment * info.alignment;
+        offsets_.push_back(offset);
+        offset += static_cast<std::size_t>(info.size) * capacity_;
+      }
+      if (offset <= CHUNK_BYTES) break;
+      capacity_--;
+    }
+    if (capacity_ == 0) throw std::runtime_error("Archetype row does not fit in a chunk");
+
+    for (std::size_t column = 0; column < components_.size(); column++) {
+      columns_[components_[column].id] = static_cast<std::int8_t>(column);
+    }
+  }
+
+  std::uint32_t Archetype::push_row(const Entity entity) {
+    if (size_ == chunks_.size() * capacity_) chunks_.push_back(std::make_unique<Chunk>());
+
+    const std::uint32_t row = size_++;
+    Chunk &chunk = *chunks_[row / capacity_];
+    reinterpret_cast<Entity *>(chunk.data)[row % capacity_] = entity;
+    chunk.count++;
+    return row;
+  }
+
+  Entity Archetype::remove_row(const std::uint32_t row) {
+    const std::uint32_t last = --size_;
+    Chunk &last_chunk = *chunks_[last / capacity_];
+    Entity moved{};
+
+    // ---- Fill The Hole With The Last Row So Chunks Stay Dense ----
+    if (row != last) {
+      moved = entity(last);
+      reinterpret_cast<Entity *>(chunks_[row / capacity_]->data)[row % capacity_] = moved;
+      for (const auto &info : components_) {
+        std::memcpy(component(row, info.id), component(last, info.id), info.size);
+      }
+    }
+
+    last_chunk.count--;
+    if (last_chunk.count == 0) chunks_.pop_back();
+    return moved;
+  }
+
+  std::byte *Archetype::component(const std::uint32_t row, const std::uint32_t id) const {
+    Chunk &chunk = *chunks_[row / capacity_];
+    const auto column = static_cast<std::size_t>(columns_[id]);
+    return chunk.data + offsets_[column] + static_cast<std::size_t>(components_[column].size) * (row % capacity_);
+  }
+
+  Entity Archetype::entity(const std::uint32_t row) const {
+    return reinterpret_cast<const Entity *>(chunks_[row / capacity_]->data)[row % capacity_];
+  }
+
+  // ---- World: Entities ----
+  void World::destroy(const Entity entity) {
+    const Record *record = find(entity);
+    if (!record) return;
+
+    release_row(record->archetype, record->row);
+
+    // ---- Bump The Generation So Stale Handles Stop Resolving ----
+    Record &slot = records_[entity.index];
+    slot.archetype = nullptr;
+    slot.generation++;
+    free_indices_.push_back(entity.index);
+    alive_--;
+  }
+
+  void World::clear() {
+    records_.clear();
+    free_indices_.clear();
+    archetype_lookup_.clear();
+    archetypes_.clear();
+    alive_ = 0;
+  }
+
+  // ---- World: Private ----
+  Archetype *World::get_archetype(const ComponentMask mask, const std::vector<ComponentInfo> &components) {
+    if (const auto it = archetype_lookup_.find(mask); it != archetype_lookup_.end()) return it->second;
+
+    archetypes_.push_back(std::make_unique<Archetype>(mask, components));
+    Archetype *archetype = archetypes_.back().get();
+    archetype_lookup_.emplace(mask, archetype);
+    return archetype;
+  }
+
+  Entity World::allocate(Archetype *archetype) {
+    std::uint32_t index;
+    if (!free_indices_.empty()) {
+      index = free_indices_.back();
+      free_indices_.pop_back();
+    } else {
+      index = static_cast<std::uint32_t>(records_.size());
+      records_.emplace_back();
+    }
+
+    const Entity entity{index, records_[index].generation};
+    records_[index].archetype = archetype;
+    records_[index].row = archetype->push_row(entity);
+    alive_++;
+    return entity;
+  }
+
+  void World::move_entity(const Entity entity, Archetype *target) {
+    Record &record = records_[entity.index];
+    Archetype *source = record.archetype;
+    const std::uint32_t source_row = record.row;
+
+    // ---- Copy The Components Both Archetypes Share ----
+    const std::uint32_t target_row = target->push_row(entity);
+    for (const auto &info : source->get_components()) {
+      if (target->has(info.id)) {
+        std::memcpy(target->component(target_row, info.id), source->component(source_row, info.id), info.size);
+      }
+    }
+
+    release_row(source, source_row);
+    record.archetype = target;
+    record.row = target_row;
+  }
+
+  void World::release_row(Archetype *archetype, const std::uint32_t row) {
+    const Entity moved = archetype->remove_row(row);
+    if (moved.is_valid()) records_[moved.index].row = row;
+  }
+
+  const World::Record *World::find(const Entity entity) const {
+    if (entity.index >= records_.size()) return nullptr;
+    const Record &record = records_[entity.index];
+    if (!record.archetype || record.generation != entity.generation) return nullptr;
+    return &record;
+  }
+} // STARBORN
@@ -3,11 +3,22 @@
 */
 
 #include "Player.hpp"
+#include <algorithm>
 
 namespace STARMAN {
+  namespace {
+    // ---- Capsule From Chest To Eye ----
+    constexpr float CAPSULE_HEIGHT = 0.4f;
+    constexpr float CAPSULE_RADIUS = 0.25f;
+    // Gap kept from surfaces so the next sweep doesn't start in contact.
+    constexpr float SKIN = 0.01f;
+    constexpr int MAX_SLIDES = 3;
+  }
+
   // ---- Constructor ----
   Player::Player(const glm::vec3& position, float yaw, float pitch, float speed) :
-  position_(position), yaw_(yaw), pitch_(pitch), speed_(speed) {
+  position_(position), yaw_(yaw), pitch_(pitch), speed_(speed),
+  previous_position_(position) {
     // ---- Initialize Direction Vectors ----
     update_vectors();
 
@@ -21,10 +32,29 @@ namespace STARMAN {
   }
 
   // ---- Update ----
-  void Player::update(float delta_time) {
+  void Player::update(float delta_time, const STARBORN::CollisionScene *collision) {
+    previous_position_ = position_;
+
     handle_rotation();
-    handle_movement(delta_time);
-    sync_camera();
+    handle_movement(delta_time, collision);
+  }
+
+  void Player::interpolate(const float alpha) const {
+    if (!camera_) return;
+
+    const glm::vec3 position = previous_position_ + (position_ - previous_position_) * alpha;
+
+    // ---- Late-Latch Mouse Look: Motion That Arrived After The Last Tick ----
+    glm::vec2 look_offset(0.0f);
+    if (!first_mouse_) {
+      const glm::vec2 cursor_position = STARBORN::Input::get_instance().get_cursor_position();
+      look_offset = glm::vec2(cursor_position.x - last_cursor_.x, last_cursor_.y - cursor_position.y) * mouse_sensitivity_;
+    }
+    const float yaw = glm::radians(yaw_ + look_offset.x);
+    const float pitch = glm::radians(glm::clamp(pitch_ + look_offset.y, -89.0f, 89.0f));
+
+    const glm::vec3 direction = glm::normalize(glm::vec3(cos(yaw) * cos(pitch), sin(pitch), sin(yaw) * cos(pitch)));
+    camera_->set_view(position, direction);
   }
 
   // ---- Helpers ----
@@ -41,15 +71,11 @@ namespace STARMAN {
   }
 
   void Player::sync_camera() const {
-    if (camera_) {
-      camera_->set_position(position_);
-      camera_->set_target(position_ + direction_);
-      camera_->set_direction(direction_);
-    }
+    if (camera_) camera_->set_view(position_, direction_);
   }
 
   // ---- Movement ----
-  void Player::handle_movement(float delta_time) {
+  void Player::handle_movement(float delta_time, const STARBORN::CollisionScene *collision) {
     auto& input = STARBORN::Input::get_instance();
     const float movement_speed = speed_ * delta_time;
     glm::vec3 movement_direction(0.0f);
@@ -69,30 +95,48 @@ namespace STARMAN {
       movement_direction = normalize(movement_direction);
 
     // ---- Apply ----
-    position_ += movement_direction * movement_speed;
+    if (collision) move_and_slide(movement_direction * movement_speed, *collision);
+    else position_ += movement_direction * movement_speed;
+  }
+
+  void Player::move_and_slide(glm::vec3 motion, const STARBORN::CollisionScene &collision) {
+    for (int slide = 0; slide < MAX_SLIDES; slide++) {
+      const STARBORN::Capsule capsule{position_ - glm::vec3(0.0f, CAPSULE_HEIGHT, 0.0f), position_, CAPSULE_RADIUS};
+      STARBORN::SweepHit hit;
+      if (!collision.sweep_capsule(capsule, motion, hit)) {
+        position_ += motion;
+        return;
+      }
+
+      // ---- Already Inside: Push Out Along The Contact Normal First ----
+      if (hit.depth > 0.0f) position_ += hit.normal * (hit.depth + SKIN);
+
+      // ---- Advance To Just Short Of Contact, Then Slide The Rest Along The Surface ----
+      const float travel = length(motion);
+      if (travel <= 0.0f) return;
+      const float advance = std::max(0.0f, hit.fraction * travel - SKIN);
+      position_ += motion * (advance / travel);
+      motion *= 1.0f - hit.fraction;
+      motion -= hit.normal * dot(motion, hit.normal);
+      if (dot(motion, motion) <= 1e-10f) return;
+    }
   }
 
   void Player::handle_rotation() {
     auto& input = STARBORN::Input::get_instance();
-    static bool first_mouse = true;
-    static float last_x = 400.0f;
-    static float last_y = 300.0f;
-
     glm::vec2 cursor_position = input.get_cursor_position();
 
     // ---- First Frame ----
-    if (first_mouse) {
-      last_x = cursor_position.x;
-      last_y = cursor_position.y;
-      first_mouse = false;
+    if (first_mouse_) {
+      last_cursor_ = cursor_position;
+      first_mouse_ = false;
     }
 
     // ---- Calculate Offsets ----
-    float x_offset = cursor_position.x - last_x;
-    float y_offset = last_y - cursor_position.y;
+    float x_offset = cursor_position.x - last_cursor_.x;
+    float y_offset = last_cursor_.y - cursor_position.y;
 
-    last_x = cursor_position.x;
-    last_y = cursor_position.y;
+    last_cursor_ = cursor_position;
 
     // ---- Apply Sensitivity ----
     x_offset *= mouse_sensitivity_;
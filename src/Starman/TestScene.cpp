@@ -3,76 +3,329 @@
 */
 
 #include "TestScene.hpp"
-#include "Input.hpp"
+#include "GLExtensions.hpp"
+#include "Components.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
 
 namespace STARMAN {
-  TestScene::TestScene(const STARBORN::Window &window)
-    : shader_("assets/shaders/basic.vert", "assets/shaders/basic.frag"),
-    test_model_("assets/models/test_models/tm_002.glb"),
+  namespace {
+    constexpr int DEBRIS_COUNT = 24;
+    constexpr float DEBRIS_RING = 4.0f;
+    constexpr float DEBRIS_RADIUS = 0.15f;
+    constexpr float THRUSTER_ORBIT = 3.0f;
+    constexpr std::uint32_t SPARKS_PER_CONTACT = 48;
+    // Closing speed below which a contact counts as resting and throws no sparks.
+    constexpr float SPARK_IMPACT_SPEED = 0.1f;
+  }
+
+  TestScene::TestScene(const STARBORN::Window &window, const STARBORN::RenderSettings &settings)
+    : test_model_("assets/models/test_models/tm_002.glb"),
     player_(glm::vec3(0.0f)),
-    window_(window) {
-    player_.set_aspect_ratio(16.0f / 9.0f);
+    render_settings_(settings) {
+    player_.set_aspect_ratio(static_cast<float>(window.get_width()) / static_cast<float>(window.get_height()));
+
+    // ---- Entities ----
+    const std::uint32_t model_node = transforms_.add(STARBORN::TransformHierarchy::NO_PARENT,
+      {glm::vec3(0.0f, 0.0f, -5.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(2.0f)});
+    STARBORN::MeshRenderer renderer{&test_model_};
+    if (!test_model_.clips_.empty()) {
+      renderer.animator = static_cast<std::uint32_t>(animators_.size());
+      animators_.emplace_back(test_model_.skeleton_);
+      animators_.back().set_pose_cache(&pose_cache_);
+      animators_.back().play(test_model_.clips_.front());
+    }
+    world_.create(STARBORN::TransformNode{model_node}, STARBORN::WorldMatrix{}, renderer);
+
+    // ---- Debris: A Ring Drifting Inwards Onto A Static Body At The Model ----
+    const glm::vec3 center(0.0f, 0.0f, -5.0f);
+    physics_.create_body(center, 1.5f, 0.0f);
+    for (int i = 0; i < DEBRIS_COUNT; i++) {
+      const float angle = 6.2831853f * static_cast<float>(i) / DEBRIS_COUNT;
+      const glm::vec3 offset(std::cos(angle) * DEBRIS_RING, std::sin(angle * 3.0f) * 0.5f, std::sin(angle) * DEBRIS_RING);
+      const glm::vec3 velocity = -offset * (0.3f + 0.05f * static_cast<float>(i % 4));
+      const std::uint32_t body = physics_.create_body(center + offset, DEBRIS_RADIUS, 1.0f, velocity);
+      const std::uint32_t node = transforms_.add(STARBORN::TransformHierarchy::NO_PARENT,
+        {center + offset, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(DEBRIS_RADIUS)});
+      world_.create(STARBORN::TransformNode{node}, STARBORN::WorldMatrix{}, STARBORN::RigidBody{body},
+                    STARBORN::MeshRenderer{&test_model_});
+    }
+
+    // ---- Particles: A Thruster Orbiting The Model, Sparks Where Debris Hits ----
+    STARBORN::ParticleEmitterDesc thruster;
+    thruster.capacity = 2048;
+    thruster.lifetime_min = 0.6f;
+    thruster.lifetime_max = 1.2f;
+    thruster.speed_min = 0.5f;
+    thruster.speed_max = 1.5f;
+    thruster.spread = 0.15f;
+    thruster.drag = 1.0f;
+    thruster.size_start = 0.08f;
+    thruster.size_end = 0.01f;
+    thruster.color_start = glm::vec4(1.0f, 0.7f, 0.3f, 1.0f);
+    thruster.color_end = glm::vec4(0.3f, 0.1f, 1.0f, 0.0f);
+    thruster_ = STARBORN::ParticleEmitter(particles_.add_emitter(thruster), 1200.0f);
+
+    STARBORN::ParticleEmitterDesc sparks;
+    sparks.capacity = 1024;
+    sparks.lifetime_min = 0.3f;
+    sparks.lifetime_max = 0.7f;
+    sparks.speed_min = 1.0f;
+    sparks.speed_max = 3.0f;
+    sparks.spread = 1.0f;
+    sparks.gravity = glm::vec3(0.0f, -4.0f, 0.0f);
+    sparks.size_start = 0.03f;
+    sparks.color_start = glm::vec4(1.0f, 0.9f, 0.6f, 1.0f);
+    sparks.color_end = glm::vec4(1.0f, 0.3f, 0.0f, 0.0f);
+    sparks_ = STARBORN::ParticleEmitter(particles_.add_emitter(sparks));
+
+    // ---- Systems ----
+    // ---- Bodies Were Stepped Before update(); Copy Them Into The Hierarchy ----
+    schedule_.add("physics_sync",
+                  STARBORN::component_mask<STARBORN::RigidBody, STARBORN::TransformNode>(),
+                  STARBORN::component_mask<STARBORN::TransformHierarchyResource>(),
+                  [this](const STARBORN::World &world, float) {
+                    world.each<STARBORN::RigidBody, STARBORN::TransformNode>(
+                      [this](const STARBORN::RigidBody &body, const STARBORN::TransformNode &node) {
+                        transforms_.set_position(node.node, physics_.get_position(body.body));
+                      });
+                  });
+    // ---- update() Refreshes The Hierarchy's Cached World Matrices, So It Writes It ----
+    schedule_.add("world_matrices",
+                  STARBORN::component_mask<STARBORN::TransformNode>(),
+                  STARBORN::component_mask<STARBORN::WorldMatrix, STARBORN::TransformHierarchyResource>(),
+                  [this](const STARBORN::World &world, float) {
+                    transforms_.update();
+                    world.parallel_each<STARBORN::TransformNode, STARBORN::WorldMatrix>(
+                      [this](const STARBORN::TransformNode &node, STARBORN::WorldMatrix &matrix) {
+                        matrix.value = transforms_.get_world(node.node);
+                      });
+                  });
+    // ---- Animators Live Outside The World, So This Batches With Everything ----
+    schedule_.add("animation", 0, 0, [this](STARBORN::World &, const float delta_time) {
+      pose_cache_.clear();
+      STARBORN::JobSystem::get_instance().parallel_for(animators_.size(), 4,
+        [&](const std::size_t begin, const std::size_t end) {
+          for (std::size_t i = begin; i < end; i++) animators_[i].update(delta_time);
+        });
+    });
+    schedule_.run(world_, 0.0f);
+
+    // ---- Collision: The Model Doesn't Move, So Place Its Tree Once ----
+    collision_.add(test_model_.collision_, transforms_.get_world(model_node));
   }
 
   void TestScene::init() {
-    STARBORN::Input::get_instance().init(window_.get_window());
     glEnable(GL_DEPTH_TEST);
     STARBORN::ScreenQuad::init();
-    frame_buffer_ = std::make_unique<STARBORN::FrameBuffer>(window_.get_width(), window_.get_height());
-    post_processing_shader_ = std::make_unique<STARBORN::Shader>(
-      "assets/shaders/post.vert", "assets/shaders/post.frag");
+
+    // ---- Reverse-Z: 0..1 Clip Depth, Or Standard Depth On Plain 3.3 ----
+    if (render_settings_.reverse_z && !STARBORN::GLExtensions::has_clip_control()) {
+      std::cout << "REVERSE_Z::CLIP_CONTROL_UNAVAILABLE. USING STANDARD DEPTH" << std::endl;
+      render_settings_.reverse_z = false;
+    }
+    if (render_settings_.reverse_z) STARBORN::GLExtensions::clip_control(GL_LOWER_LEFT, GL_ZERO_TO_ONE);
+    player_.get_camera()->set_projection_mode(render_settings_.reverse_z
+                                                ? STARBORN::Camera::Projection::REVERSE_Z_INFINITE
+                                                : STARBORN::Camera::Projection::STANDARD);
+
+    // ---- Shaders ----
+    auto &shaders = STARBORN::ShaderLibrary::get_instance();
+    shaders.request("mesh_fallback", "../shaders/fallback_mesh.vert", "../shaders/fallback_mesh.frag");
+    shaders.request("basic", "assets/shaders/basic.vert", "assets/shaders/basic.frag", "mesh_fallback");
+    shaders.request("skinned", "assets/shaders/skinned.vert", "assets/shaders/basic.frag", "mesh_fallback");
+    shaders.request("particles", "assets/shaders/particles.vert", "assets/shaders/particles.frag");
+    shaders.compile_all();
+
+    // ---- Fallbacks Are Tiny, Block On Them So The First Frame Has Something To Draw ----
+    shaders.finish("mesh_fallback");
+
+    // ---- Post Processing ----
+    post_process_.init();
+    post_process_.set_effects(STARBORN::PostProcess::QUANTIZE | STARBORN::PostProcess::DITHER);
+    post_process_.set_quantize(8, 0.8f);
+    post_process_.set_dither(1.0f);
+    post_process_.prewarm(STARBORN::PostProcess::QUANTIZE | STARBORN::PostProcess::DITHER |
+                          STARBORN::PostProcess::SHARPEN);
+
+    // ---- Dynamic Resolution ----
+    dynamic_resolution_.init();
+
+    // ---- Skinning ----
+    skinning_buffer_.init();
+
+    // ---- Particles ----
+    particles_.init();
   }
 
   void TestScene::update(float delta_time) {
     // ---- Update Player ----
-    player_.update(delta_time);
+    player_.update(delta_time, &collision_);
+
+    // ---- Update Systems ----
+    schedule_.run(world_, delta_time);
+
+    // ---- Emitters ----
+    elapsed_ += delta_time;
+    const glm::vec3 orbit(std::cos(elapsed_), 0.0f, std::sin(elapsed_));
+    thruster_.set_position(glm::vec3(0.0f, 1.0f, -5.0f) + orbit * THRUSTER_ORBIT);
+    thruster_.set_direction(glm::vec3(orbit.z, 0.0f, -orbit.x));
+    thruster_.update(delta_time);
+
+    // ---- Only Impacts Spark; Settled Pairs Stay In Contact Every Tick ----
+    const auto &contacts = physics_.get_contacts();
+    const auto impact = std::ranges::find_if(contacts, [](const STARBORN::PhysicsWorld::Contact &contact) {
+      return contact.normal_velocity < -SPARK_IMPACT_SPEED;
+    });
+    if (impact != contacts.end()) {
+      const auto &contact = *impact;
+      sparks_.set_position((physics_.get_position(contact.a) + physics_.get_position(contact.b)) * 0.5f, true);
+      sparks_.set_direction(contact.normal);
+      sparks_.burst(SPARKS_PER_CONTACT);
+    }
+    sparks_.update(delta_time);
   }
 
-  void TestScene::render() {
+  void TestScene::extract(STARBORN::FramePacket &packet, const float alpha) {
+    // ---- Camera Between The Last Two Ticks ----
+    player_.interpolate(alpha);
     const auto camera = player_.get_camera();
+    packet.camera.view = camera->get_view_matrix();
+    packet.camera.projection = camera->get_projection_matrix();
+    packet.camera.position = camera->get_position();
+
+    // ---- Lights ----
+    packet.lights.push_back({glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(1.0f, 1.0f, 1.0f)});
 
-    // ---- Render to Frame Buffer ----
-    frame_buffer_->bind();
+    // ---- Draw Items ----
+    world_.each<STARBORN::WorldMatrix, STARBORN::MeshRenderer>(
+      [&](const STARBORN::WorldMatrix &matrix, const STARBORN::MeshRenderer &renderer) {
+        STARBORN::FramePacket::DrawItem item{renderer.model, matrix.value};
+        if (renderer.animator != STARBORN::MeshRenderer::NO_ANIMATOR) {
+          const auto palette = animators_[renderer.animator].get_palette();
+          item.joint_offset = static_cast<std::uint32_t>(packet.joint_palettes.size());
+          item.joint_count = static_cast<std::uint32_t>(palette.size());
+          packet.joint_palettes.insert(packet.joint_palettes.end(), palette.begin(), palette.end());
+        }
+        packet.draw_items.push_back(item);
+      });
+
+    // ---- Particles ----
+    packet.particle_emissions.push_back(thruster_.extract());
+    packet.particle_emissions.push_back(sparks_.extract());
+  }
+
+  void TestScene::render(const STARBORN::FramePacket &packet) {
+    const STARBORN::RenderTargetDesc screen{packet.width, packet.height, render_settings_.scene_target()};
+    const glm::ivec2 render_size = dynamic_resolution_.get_render_size(screen.width, screen.height);
+    dynamic_resolution_.begin_frame();
+
+    // ---- Sharpen Only While Upsampling ----
+    std::uint32_t effects = STARBORN::PostProcess::QUANTIZE | STARBORN::PostProcess::DITHER;
+    if (render_size.x < screen.width) effects |= STARBORN::PostProcess::SHARPEN;
+    post_process_.set_effects(effects);
+    post_process_.set_source_region({screen.width, screen.height}, render_size);
+
+    // ---- Build Frame Graph ----
+    render_graph_.reset();
+    const auto backbuffer = render_graph_.import_target("backbuffer", nullptr, screen);
+    STARBORN::RenderGraph::TextureHandle scene_color;
+
+    render_graph_.add_pass("scene",
+      [&](STARBORN::RenderGraph::Builder &builder) {
+        scene_color = builder.create("scene_color", screen);
+      },
+      [&](const STARBORN::RenderGraph::Resources &resources) {
+        resources.bind(scene_color);
+        glViewport(0, 0, render_size.x, render_size.y);
+        render_scene(packet);
+      });
+
+    render_graph_.add_pass("post",
+      [&](STARBORN::RenderGraph::Builder &builder) {
+        builder.read(scene_color);
+        builder.write(backbuffer);
+      },
+      [&](const STARBORN::RenderGraph::Resources &resources) {
+        resources.bind(backbuffer);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // ---- Fullscreen Pass: Depth Would Only Get In The Way ----
+        glDisable(GL_DEPTH_TEST);
+        post_process_.apply(resources.get_texture_id(scene_color));
+        glEnable(GL_DEPTH_TEST);
+      });
+
+    // ---- Execute ----
+    render_graph_.compile();
+    render_graph_.execute();
+    dynamic_resolution_.end_frame();
+  }
+
+  void TestScene::render_scene(const STARBORN::FramePacket &packet) {
+    auto &shaders = STARBORN::ShaderLibrary::get_instance();
+    auto &shader = shaders.get("basic");
+
+    // ---- Reverse-Z Clears To 0 (Infinity) And Keeps The Larger Depth ----
     glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+    glClearDepth(render_settings_.reverse_z ? 0.0 : 1.0);
+    glDepthFunc(render_settings_.reverse_z ? GL_GREATER : GL_LESS);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    shader_.use();
-    shader_.set_vec3("viewPos", camera->get_position());
-    shader_.set_vec3("lightPos", glm::vec3(2.0f, 2.0f, 2.0f));
-    shader_.set_vec3("lightColor", glm::vec3(1.0f, 1.0f, 1.0f));
-    shader_.set_float("shininess", 32.0f);
+    shader.use();
+    shader.set_vec3("viewPos", packet.camera.position);
+    if (!packet.lights.empty()) {
+      shader.set_vec3("lightPos", packet.lights.front().position);
+      shader.set_vec3("lightColor", packet.lights.front().color);
+    }
+    shader.set_float("shininess", 32.0f);
 
     // ---- Set projection and view matrices ----
-    shader_.set_mat4("projection", camera->get_projection_matrix());
-    shader_.set_mat4("view", camera->get_view_matrix());
-
-    // ---- Draw ----
-    auto model = glm::mat4(1.0f);
-    model = translate(model, glm::vec3(0.0f, 0.0f, -5.0f));
-    model = scale(model, glm::vec3(2.0f));
-    shader_.set_mat4("model", model);
-    test_model_.draw(shader_);
-
-    // ---- Render to Screen ----
-    frame_buffer_->unbind();
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    post_processing_shader_->use();
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, frame_buffer_->get_texture_id());
-    post_processing_shader_->set_int("screenTexture", 0);
-
-    // ---- Post Processing Effects ----
-    post_processing_shader_->set_bool("applyQuantize", true);
-    post_processing_shader_->set_float("quantizeIntensity", 0.8f);
-    post_processing_shader_->set_int("colorLevels", 8);
-    post_processing_shader_->set_bool("applyDither", true);
-    post_processing_shader_->set_float("ditherIntensity", 1.0f);
-
-    // ---- Draw Screen Quad ----
-    STARBORN::ScreenQuad::draw();
+    shader.set_mat4("projection", packet.camera.projection);
+    shader.set_mat4("view", packet.camera.view);
+
+    // ---- Draw Rigid Items ----
+    for (const auto &item : packet.draw_items) {
+      if (item.joint_count == 0) item.model->draw(shader, item.transform);
+    }
+
+    // ---- Draw Skinned Items: One Palette Upload Each ----
+    auto &skinned = shaders.get("skinned");
+    bool skinned_bound = false;
+    for (const auto &item : packet.draw_items) {
+      if (item.joint_count == 0) continue;
+      if (!skinned_bound) {
+        skinned.use();
+        // ---- Hot Reload Makes New Programs, So Re-Attach The Block Each Frame ----
+        STARBORN::SkinningBuffer::attach(skinned.ID);
+        skinned.set_vec3("viewPos", packet.camera.position);
+        if (!packet.lights.empty()) {
+          skinned.set_vec3("lightPos", packet.lights.front().position);
+          skinned.set_vec3("lightColor", packet.lights.front().color);
+        }
+        skinned.set_float("shininess", 32.0f);
+        skinned.set_mat4("projection", packet.camera.projection);
+        skinned.set_mat4("view", packet.camera.view);
+        skinned.set_bool("skinned", true);
+        skinned_bound = true;
+      }
+      skinning_buffer_.upload({packet.joint_palettes.data() + item.joint_offset, item.joint_count});
+      item.model->draw(skinned, item.transform);
+    }
+
+    // ---- Particles Last: They Test Against Opaque Depth But Don't Write It ----
+    particles_.simulate(packet.particle_emissions, packet.delta_time);
+    if (shaders.is_ready("particles")) {
+      particles_.draw(shaders.get("particles"), packet.camera.view, packet.camera.projection);
+    }
   }
 
   void TestScene::cleanup() {
+    particles_.cleanup();
+    skinning_buffer_.cleanup();
+    dynamic_resolution_.cleanup();
+    post_process_.cleanup();
     STARBORN::ScreenQuad::cleanup();
   }
 
@@ -83,4 +336,9 @@ namespace STARMAN {
   void TestScene::on_exit() {
     // Empty
   }
+
+  void TestScene::on_resize(const int width, const int height) {
+    // ---- Projection Updates In Place, Targets Follow The Next Packet's Size ----
+    player_.set_aspect_ratio(static_cast<float>(width) / static_cast<float>(height));
+  }
 }
\ No newline at end of file
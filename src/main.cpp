@@ -9,50 +9,199 @@
 #include "Input.hpp"
 #include "TestScene.hpp"
 #include "SceneManager.hpp"
+#include "ShaderLibrary.hpp"
+#include "RenderTargetPool.hpp"
+#include "RenderSettings.hpp"
+#include "FramePacer.hpp"
+#include "FixedTimestep.hpp"
+#include "RenderThread.hpp"
+#include "JobSystem.hpp"
+#include "InputRecording.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <thread>
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-int main() {
+int main(const int argc, char **argv) {
+  // ---- Command Line: --record <file> / --replay <file> ----
+  const char *record_path = nullptr;
+  const char *replay_path = nullptr;
+  for (int i = 1; i + 1 < argc; i++) {
+    if (std::strcmp(argv[i], "--record") == 0) record_path = argv[++i];
+    else if (std::strcmp(argv[i], "--replay") == 0) replay_path = argv[++i];
+  }
+
   // ---- Create Window ----
   STARBORN::Window window(800, 600, "Starman's Odyssey");
 
+  // ---- Worker Threads For Loading & Simulation ----
+  STARBORN::JobSystem::get_instance().init();
+
   // ---- Input ----
-  STARBORN::Input::get_instance().init(window.get_window());
+  auto &input = STARBORN::Input::get_instance();
+  input.init(window.get_window());
+
+  // ---- Frame Pacing, Simulation Rate & Development Options ----
+  const auto settings = STARBORN::RenderSettings::load("assets/config/render.json");
+  STARBORN::FramePacer frame_pacer;
 
-  // ---- Setup Scene Manager ----
+  // ---- Rebuild Shaders When Their Sources Change ----
+  STARBORN::ShaderLibrary::get_instance().set_hot_reload(settings.shader_hot_reload);
+
+  // ---- Replay Replaces Live Input And Wall-Clock Ticks ----
+  STARBORN::InputReplay replay;
+  double tick_rate = settings.tick_rate;
+  if (replay_path && replay.load(replay_path)) {
+    tick_rate = replay.get_tick_rate();
+    input.set_live(false);
+  }
+  STARBORN::InputRecorder recorder;
+  if (record_path) recorder.open(record_path, tick_rate);
+  STARBORN::FixedTimestep timestep(tick_rate, settings.max_catch_up_steps);
   auto &scene_manager = STARBORN::SceneManager::get_instance();
-  scene_manager.add_scene("test_scene", std::make_unique<STARMAN::TestScene>(window));
+
+  // ---- Render Thread Owns The GL Context From Here On ----
+  int target_width = window.get_width();
+  int target_height = window.get_height();
+  double last_input_time = 0.0;
+  double latency_total_ms = 0.0;
+  double latency_max_ms = 0.0;
+  int latency_samples = 0;
+  STARBORN::RenderThread render_thread;
+  render_thread.start(window.get_window(), [&](const STARBORN::FramePacket &packet) {
+    // ---- Render Targets Follow The Size The Packet Was Built For ----
+    if (packet.width != target_width || packet.height != target_height) {
+      STARBORN::RenderTargetPool::get_instance().resize(target_width, target_height, packet.width, packet.height);
+      target_width = packet.width;
+      target_height = packet.height;
+    }
+
+    // ---- Finish Background Shader Builds & Hot Reloads ----
+    STARBORN::ShaderLibrary::get_instance().poll();
+
+    // ---- Render Scene ----
+    STARBORN::SceneManager::render(packet);
+
+    // ---- Present ----
+    glfwSwapBuffers(window.get_window());
+    frame_pacer.end_frame();
+
+    // ---- Input-To-Present Latency, For Frames Carrying New Input ----
+    if (packet.input_time > last_input_time && !replay.is_loaded()) {
+      const double latency_ms = (glfwGetTime() - packet.input_time) * 1000.0;
+      latency_total_ms += latency_ms;
+      latency_max_ms = std::max(latency_max_ms, latency_ms);
+      if (++latency_samples == 600) {
+        std::cout << "INPUT::LATENCY mean " << latency_total_ms / latency_samples << " ms max "
+                  << latency_max_ms << " ms" << std::endl;
+        latency_total_ms = latency_max_ms = 0.0;
+        latency_samples = 0;
+      }
+    }
+    last_input_time = packet.input_time;
+  }, settings.render_thread);
+
+  // ---- Setup Scene Manager (Loading Creates GL Objects) ----
+  render_thread.execute([&] {
+    frame_pacer.init(window.get_window(), settings.frame_pacing());
+    scene_manager.add_scene("test_scene", std::make_unique<STARMAN::TestScene>(window, settings));
+  });
+  scene_manager.set_render_thread(&render_thread);
   scene_manager.set_active_scene("test_scene");
 
-  // ---- Disable VSync ----
-  glfwSwapInterval(0);
+  // ---- Rendering Inline Happens On The Simulation Thread, So The Context Moves There ----
+  const bool render_inline = !render_thread.is_threaded();
+  if (render_inline) glfwMakeContextCurrent(nullptr);
 
-  float last_frame = 0.0f;
-  // ---- Main Loop ----
-  while (!glfwWindowShouldClose(window.get_window())) {
-    float ambient_strength = 1.0f;
-    // ---- Time ----
-    const auto current_frame = static_cast<float>(glfwGetTime());
-    float delta_time = current_frame - last_frame;
-    last_frame = current_frame;
+  // ---- Simulation Thread: Input, Ticks, Then Hand The Frame Over ----
+  std::atomic<bool> running{true};
+  std::exception_ptr simulation_error;
+  std::thread simulation([&] {
+    if (render_inline) glfwMakeContextCurrent(window.get_window());
 
-    if (delta_time > 0.1f) delta_time = 0.1f;
+    try {
+      STARBORN::FramePacket packet;
+      std::uint64_t frame_index = 0;
+      double last_frame_time = glfwGetTime();
+      while (running.load()) {
+        // ---- Don't Run Ahead Of The GPU: Wait Before Sampling Input, So It Isn't Stale ----
+        // The fence needs the context, so the wait runs on the render thread once it
+        // has presented the previous packet; this thread blocks until it is done.
+        render_thread.execute([&] { frame_pacer.wait_for_gpu(); });
 
-    // ---- Update Input ----
-    STARBORN::Input::get_instance().update();
+        // ---- Start The Frame: Queued Events Become Current State ----
+        input.update();
 
-    // ---- Update Scene ----
-    scene_manager.update(delta_time);
+        // ---- Apply Coalesced Resize, At Most Once Per Frame ----
+        if (window.consume_resize()) scene_manager.resize(window.get_width(), window.get_height());
 
-    // ---- Render Scene ----
-    scene_manager.render();
+        // ---- Tick Count Comes From The Clock, Or From The Recording ----
+        const double now = glfwGetTime();
+        STARBORN::InputReplay::Step step{};
+        if (replay.is_loaded()) {
+          const auto next = replay.next_frame(input);
+          if (!next) break;
+          step = *next;
+        } else {
+          step.ticks = timestep.advance(now);
+          step.alpha = timestep.get_alpha();
+        }
+        recorder.record_frame(now, step.ticks, step.alpha, input.get_events());
 
-    // ---- Event Polling ----
-    glfwSwapBuffers(window.get_window());
-    glfwPollEvents();
-  }
+        // ---- Update Scene In Fixed Ticks ----
+        for (int tick = 0; tick < step.ticks; tick++) scene_manager.update(timestep.get_step());
+
+        // ---- Latest Possible Input Before Capturing The Frame ----
+        input.poll();
+
+        // ---- Capture The Frame Between The Last Two Ticks ----
+        packet.clear();
+        packet.frame_index = frame_index++;
+        packet.width = window.get_width();
+        packet.height = window.get_height();
+        packet.input_time = input.get_last_event_time();
+        // ---- Replays Step Effects By Recorded Ticks, So They Match Run To Run ----
+        packet.delta_time = replay.is_loaded() ? static_cast<float>(step.ticks) * timestep.get_step()
+                                               : static_cast<float>(now - last_frame_time);
+        last_frame_time = now;
+        scene_manager.extract(packet, step.alpha);
 
+        // ---- Render Thread Draws It While The Next Frame Simulates ----
+        render_thread.submit(packet);
+      }
+    } catch (...) {
+      simulation_error = std::current_exception();
+    }
+
+    if (render_inline) glfwMakeContextCurrent(nullptr);
+
+    // ---- Replay Finished Or Something Failed: Wake The Event Loop ----
+    running = false;
+    glfwPostEmptyEvent();
+  });
+
+  // ---- Main Thread Only Pumps Events, As GLFW Requires ----
+  while (running.load() && !glfwWindowShouldClose(window.get_window())) glfwWaitEventsTimeout(0.1);
+  running = false;
+  simulation.join();
+
+  recorder.close();
+  replay.report();
+
+  // ---- GL Teardown Happens Back On This Thread ----
+  render_thread.stop();
+  if (render_inline) glfwMakeContextCurrent(window.get_window());
+  frame_pacer.cleanup();
   scene_manager.cleanup();
+  STARBORN::ShaderLibrary::get_instance().clear();
+  STARBORN::RenderTargetPool::get_instance().clear();
+  STARBORN::JobSystem::get_instance().shutdown();
   glfwTerminate();
+
+  if (simulation_error) std::rethrow_exception(simulation_error);
   return 0;
 }
@@ -0,0 +1,66 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+ * Recording and replaying a frame that overflows Input's event list must
+ * leave the same key state both times. Events are injected, so no window
+ * or GLFW event loop is needed.
+ */
+
+#include "Input.hpp"
+#include "InputRecording.hpp"
+#include <cstdio>
+#include <filesystem>
+
+namespace {
+  int failures = 0;
+
+  void check(const bool condition, const char *what) {
+    if (condition) return;
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+  }
+
+  STARBORN::InputEvent key(const int code, const int action) {
+    return {STARBORN::InputEvent::Type::KEY, static_cast<std::uint8_t>(action), static_cast<std::int16_t>(code),
+            0.0f, 0.0f, 0.0};
+  }
+
+  // Starts a frame, releases both keys and leaves the frame empty again.
+  void reset(STARBORN::Input &input) {
+    input.update();
+    input.inject(key(GLFW_KEY_A, GLFW_RELEASE));
+    input.inject(key(GLFW_KEY_B, GLFW_RELEASE));
+    input.update();
+  }
+}
+
+int main() {
+  auto &input = STARBORN::Input::get_instance();
+  input.set_live(false);
+  const auto path = (std::filesystem::temp_directory_path() / "starborn_input_replay_test.bin").string();
+
+  // ---- Live: Fill The Frame With A Taps, Then Press B Into A Full List ----
+  reset(input);
+  for (std::size_t i = 0; i < STARBORN::Input::MAX_EVENTS / 2; i++) {
+    input.inject(key(GLFW_KEY_A, GLFW_PRESS));
+    input.inject(key(GLFW_KEY_A, GLFW_RELEASE));
+  }
+  input.inject(key(GLFW_KEY_B, GLFW_PRESS));
+  const bool live_b = input.is_key_down(GLFW_KEY_B);
+  check(input.get_dropped_event_count() > 0, "the frame overflowed");
+
+  STARBORN::InputRecorder recorder;
+  check(recorder.open(path, 60.0), "recording opened");
+  recorder.record_frame(0.0, 1, 0.0f, input.get_events());
+  recorder.close();
+
+  // ---- Replay: The Same Frame From The File ----
+  reset(input);
+  STARBORN::InputReplay replay;
+  check(replay.load(path), "recording loaded");
+  check(replay.next_frame(input).has_value(), "recording has a frame");
+  check(input.is_key_down(GLFW_KEY_B) == live_b, "replayed key state matches the live run");
+
+  std::filesystem::remove(path);
+  if (failures == 0) std::printf("input_replay_test: ok\n");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/*
+ * Created by Sarthak Rai on 19 Oct 2026.
+ * RenderGraph culling: only compile() runs, so no GL context is needed.
+ */
+
+#include "RenderGraph.hpp"
+#include <cstdio>
+
+namespace {
+  int failures = 0;
+
+  void check(const bool condition, const char *what) {
+    if (condition) return;
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+  }
+
+  const STARBORN::RenderTargetDesc TARGET{64, 64};
+}
+
+int main() {
+  using STARBORN::RenderGraph;
+
+  // ---- A Pass With No Outputs Is Culled, And So Is What Only It Reads ----
+  {
+    RenderGraph graph;
+    RenderGraph::TextureHandle scratch;
+    graph.add_pass("scratch", [&](RenderGraph::Builder &builder) { scratch = builder.create("scratch", TARGET); },
+                   [](const RenderGraph::Resources &) {});
+    graph.add_pass("no_outputs", [&](RenderGraph::Builder &builder) { builder.read(scratch); },
+                   [](const RenderGraph::Resources &) {});
+    graph.compile();
+    check(graph.get_culled_count() == 2, "pass without outputs and its producer are culled");
+  }
+
+  // ---- Side Effects And Imported Targets Keep Passes Alive ----
+  {
+    RenderGraph graph;
+    const auto backbuffer = graph.import_target("backbuffer", nullptr, TARGET);
+    RenderGraph::TextureHandle scene;
+    graph.add_pass("scene", [&](RenderGraph::Builder &builder) { scene = builder.create("scene", TARGET); },
+                   [](const RenderGraph::Resources &) {});
+    graph.add_pass("present", [&](RenderGraph::Builder &builder) {
+      builder.read(scene);
+      builder.write(backbuffer);
+    }, [](const RenderGraph::Resources &) {});
+    graph.add_pass("readback", [](RenderGraph::Builder &builder) { builder.side_effect(); },
+                   [](const RenderGraph::Resources &) {});
+    graph.compile();
+    check(graph.get_culled_count() == 0, "passes reaching an import or with side effects survive");
+  }
+
+  if (failures == 0) std::printf("render_graph_test: ok\n");
+  return failures == 0 ? 0 : 1;
+}